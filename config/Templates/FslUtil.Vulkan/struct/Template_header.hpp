@@ -35,6 +35,7 @@
 // Auto generation template based on RapidVulkan https://github.com/Unarmed1000/RapidVulkan with permission.
 
 #include <vulkan/vulkan.h>
+#include <cstddef>
 
 namespace Fsl
 {
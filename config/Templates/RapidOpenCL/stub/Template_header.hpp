@@ -0,0 +1,128 @@
+#ifndef ##NAMESPACE_NAME!##_STUB_STUBBACKEND_HPP
+#define ##NAMESPACE_NAME!##_STUB_STUBBACKEND_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+// ##AG_TOOL_STATEMENT##
+
+// A stub implementation of every ##API_NAME## entry point, link StubBackend.cpp instead of the ##API_NAME## library to test and benchmark the
+// ##NAMESPACE_NAME## classes on a host without a driver.
+// - Create functions hand out unique fake handles.
+// - Destroy functions validate the handles they are given and count them, so leaks and double destroys can be detected.
+// - All other functions return a zero initialized value and zero initialize their outputs. Array outputs are left alone and their element
+//   count output is set to zero instead.
+// Any of the functions can be given custom behaviour by installing a hook for it.
+
+#include <CL/cl.h>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace ##NAMESPACE_NAME##
+{
+  namespace Stub
+  {
+    struct Stats
+    {
+      //! The number of entry point calls
+      uint64_t Calls;
+      //! The number of handles that were handed out
+      uint64_t HandlesCreated;
+      //! The number of handles that were destroyed
+      uint64_t HandlesDestroyed;
+      //! The number of destroy calls with a handle that isn't alive (double destroys, wrong type or never created)
+      uint64_t InvalidDestroys;
+
+      Stats()
+        : Calls(0)
+        , HandlesCreated(0)
+        , HandlesDestroyed(0)
+        , InvalidDestroys(0)
+      {
+      }
+    };
+
+
+    //! A installed hook is called instead of the stub implementation of its entry point
+    struct Hooks
+    {##HOOKS##
+    };
+
+
+    //! @brief Get a copy of the installed hooks
+    Hooks GetHooks();
+
+    //! @brief Install the hooks, to change a single hook modify a copy from GetHooks and set it.
+    //! @note  The hooks are read under a lock by every entry point call, so they can be changed while other threads use the API.
+    void SetHooks(const Hooks& hooks);
+
+    //! @brief Get the current stats
+    Stats GetStats();
+
+    //! @brief Get the number of handles that have been created and not destroyed yet
+    std::size_t GetLiveHandleCount();
+
+    //! @brief Write all handles that have been created and not destroyed yet to stderr
+    //! @return the number of handles that were written
+    std::size_t ReportLiveHandles();
+
+    //! @brief Forget all handles, clear the stats and remove all hooks
+    void Reset();
+
+    //! @brief Hand out a new unique handle value (used by the generated entry points)
+    uint64_t AcquireHandle(const char* const pszTypeName);
+
+    //! @brief Validate and destroy the handle value (used by the generated entry points)
+    //! @return true if the handle was alive or null
+    bool ReleaseHandle(const char* const pszTypeName, const char* const pszFunctionName, const uint64_t handle);
+
+    //! @brief Count a entry point call (used by the generated entry points)
+    void CountCall();
+
+
+    template <typename T>
+    inline typename std::enable_if<std::is_pointer<T>::value, T>::type ToHandle(const uint64_t value)
+    {
+      return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+    }
+
+    template <typename T>
+    inline typename std::enable_if<!std::is_pointer<T>::value, T>::type ToHandle(const uint64_t value)
+    {
+      return static_cast<T>(value);
+    }
+
+    template <typename T>
+    inline typename std::enable_if<std::is_pointer<T>::value, uint64_t>::type FromHandle(const T handle)
+    {
+      return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+    }
+
+    template <typename T>
+    inline typename std::enable_if<!std::is_pointer<T>::value, uint64_t>::type FromHandle(const T handle)
+    {
+      return static_cast<uint64_t>(handle);
+    }
+  }
+}
+
+#endif
@@ -25,6 +25,7 @@
 // ##AG_TOOL_STATEMENT##
 
 #include <vulkan/vulkan.h>
+#include <cstddef>
 
 namespace RapidVulkan
 {
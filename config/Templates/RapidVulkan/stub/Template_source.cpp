@@ -0,0 +1,181 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+// ##AG_TOOL_STATEMENT##
+
+#include "StubBackend.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#define STUB_API_ENTRY VKAPI_ATTR
+#define STUB_API_CALL VKAPI_CALL
+
+namespace ##NAMESPACE_NAME##
+{
+  namespace Stub
+  {
+    namespace
+    {
+      // Keep the fake handles far away from null and aligned like real pointers
+      const uint64_t FIRST_HANDLE = 0x10000;
+      const uint64_t HANDLE_STRIDE = 0x10;
+
+      struct Registry
+      {
+        std::mutex Lock;
+        uint64_t NextHandle;
+        //! handle -> type name
+        std::unordered_map<uint64_t, const char*> Live;
+        Stats CurrentStats;
+        Hooks CurrentHooks;
+
+        Registry()
+          : NextHandle(FIRST_HANDLE)
+        {
+        }
+      };
+
+      std::atomic<uint64_t> g_calls(0);
+
+      Registry& GetRegistry()
+      {
+        static Registry registry;
+        return registry;
+      }
+
+
+      //! @brief Read a single hook (used by the generated entry points)
+      template <typename T>
+      T GetHook(T Hooks::*pHook)
+      {
+        auto& rRegistry = GetRegistry();
+        std::lock_guard<std::mutex> lock(rRegistry.Lock);
+        return rRegistry.CurrentHooks.*pHook;
+      }
+    }
+
+
+    Hooks GetHooks()
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      return rRegistry.CurrentHooks;
+    }
+
+
+    void SetHooks(const Hooks& hooks)
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      rRegistry.CurrentHooks = hooks;
+    }
+
+
+    Stats GetStats()
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      Stats stats = rRegistry.CurrentStats;
+      stats.Calls = g_calls.load(std::memory_order_relaxed);
+      return stats;
+    }
+
+
+    std::size_t GetLiveHandleCount()
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      return rRegistry.Live.size();
+    }
+
+
+    std::size_t ReportLiveHandles()
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      for (const auto& entry : rRegistry.Live)
+        std::fprintf(stderr, "##NAMESPACE_NAME##::Stub: live handle 0x%llx of type %s\n", static_cast<unsigned long long>(entry.first), entry.second);
+      return rRegistry.Live.size();
+    }
+
+
+    void Reset()
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      rRegistry.NextHandle = FIRST_HANDLE;
+      rRegistry.Live.clear();
+      rRegistry.CurrentStats = Stats();
+      rRegistry.CurrentHooks = Hooks();
+      g_calls.store(0, std::memory_order_relaxed);
+    }
+
+
+    uint64_t AcquireHandle(const char* const pszTypeName)
+    {
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      const uint64_t handle = rRegistry.NextHandle;
+      rRegistry.NextHandle += HANDLE_STRIDE;
+      rRegistry.Live.emplace(handle, pszTypeName);
+      ++rRegistry.CurrentStats.HandlesCreated;
+      return handle;
+    }
+
+
+    bool ReleaseHandle(const char* const pszTypeName, const char* const pszFunctionName, const uint64_t handle)
+    {
+      // Destroying a null handle is allowed and does nothing
+      if (handle == 0)
+        return true;
+
+      auto& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      const auto itrFind = rRegistry.Live.find(handle);
+      if (itrFind == rRegistry.Live.end() || std::strcmp(itrFind->second, pszTypeName) != 0)
+      {
+        ++rRegistry.CurrentStats.InvalidDestroys;
+        std::fprintf(stderr, "##NAMESPACE_NAME##::Stub: %s called with invalid %s handle 0x%llx\n", pszFunctionName, pszTypeName,
+                     static_cast<unsigned long long>(handle));
+        return false;
+      }
+      rRegistry.Live.erase(itrFind);
+      ++rRegistry.CurrentStats.HandlesDestroyed;
+      return true;
+    }
+
+
+    void CountCall()
+    {
+      g_calls.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+using namespace ##NAMESPACE_NAME##::Stub;
+
+extern "C"
+{##ENTRY_POINTS##
+}
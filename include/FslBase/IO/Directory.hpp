@@ -52,6 +52,10 @@ namespace Fsl
       //! @brief Check if a directory exists
       static bool Exists(const Path& path);
 
+      //! @brief Try to delete a empty directory
+      //! @return true if the directory was deleted
+      static bool TryDelete(const Path& path);
+
       //! @brief
       //! @note Could not be named getCurrentDirectory because it clashes with a windows.h define.
       static Path GetCurrentWorkingDirectory();
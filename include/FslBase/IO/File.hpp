@@ -57,6 +57,20 @@ namespace Fsl
       //! @return true if the attributes could be found, false if the path couldn't be located
       static bool TryGetAttributes(const Path& path, FileAttributes& rAttributes);
 
+      //! @brief get the size and last write time of a file
+      //! @param rLastWriteTime a platform specific time stamp, its only meant to be compared against other values from this method.
+      //! @return true if the status could be retrieved, false if the file couldn't be located
+      static bool TryGetStatus(const Path& path, uint64_t& rSize, uint64_t& rLastWriteTime);
+
+      //! @brief Move a file, if the destination exists its replaced.
+      //!        The move is atomic if both files are located on the same volume.
+      //! @throws IOException if the file couldn't be moved
+      static void Move(const Path& sourceFileName, const Path& destFileName);
+
+      //! @brief Try to delete a file
+      //! @return true if the file was deleted
+      static bool TryDelete(const Path& path);
+
       //! @brief Get the current length of a file.
       //! @throws IOException if the file isn't found.
       static uint64_t GetLength(const Path& path);
@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/IO/Path.hpp>
+#include <deque>
 #include <memory>
 #include <list>
 
@@ -69,6 +70,11 @@ namespace Fsl
       //! @brief Perform a check
       //! @return true if something was changed.
       bool Check();
+
+      //! @brief Perform a check of all paths
+      //! @param rChangedPaths the paths that changed since the last check
+      //! @return true if something was changed.
+      bool Check(std::deque<IO::Path>& rChangedPaths);
     };
   }
 }
@@ -0,0 +1,88 @@
+#ifndef FSLBASE_STRING_PATTERNAUTOMATON_HPP
+#define FSLBASE_STRING_PATTERNAUTOMATON_HPP
+/****************************************************************************************************************************************************
+ * Copyright (c) 2014 Freescale Semiconductor, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the Freescale Semiconductor, Inc. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <string>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A Aho-Corasick automaton for a fixed set of patterns.
+  //!        The failure links are resolved into a dense transition table when it's built, so scanning a string costs one table lookup per
+  //!        character no matter how many patterns there are. A node costs 1KB so it's meant for small pattern sets.
+  class PatternAutomaton
+  {
+    struct Node
+    {
+      //! Dense transition table (the automaton is fully resolved so no failure links are followed while scanning)
+      int32_t Next[256];
+      //! Index of the longest pattern that ends at this node or less than zero
+      int32_t Match;
+    };
+
+    std::vector<Node> m_nodes;
+    std::size_t m_patternCount;
+
+  public:
+    static const int32_t RootState = 0;
+
+    //! @brief Create a automaton without any patterns
+    PatternAutomaton();
+
+    //! @param patterns if a pattern occurs more than once the first entry is used. A empty pattern matches everywhere.
+    explicit PatternAutomaton(const std::vector<std::string>& patterns);
+
+    bool IsEmpty() const
+    {
+      return m_patternCount == 0;
+    }
+
+    //! @brief Advance the automaton from 'state' by one character
+    int32_t Next(const int32_t state, const char ch) const
+    {
+      return m_nodes[state].Next[static_cast<uint8_t>(ch)];
+    }
+
+    //! @brief Get the index of the longest pattern that ends in the state
+    //! @return the pattern index or less than zero if no pattern ends there
+    int32_t GetMatch(const int32_t state) const
+    {
+      return m_nodes[state].Match;
+    }
+
+    //! @brief Check if the string contains at least one of the patterns
+    bool IsFoundIn(const std::string& str) const;
+  };
+}
+
+#endif
@@ -32,11 +32,32 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/BasicTypes.hpp>
+#include <FslBase/String/PatternAutomaton.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Fsl
 {
+  //! @brief Replaces a fixed set of patterns in linear time using a Aho-Corasick automaton of the reversed patterns.
+  //!        The automaton is built once by the constructor so the same replacer can be reused for many inputs.
+  //!        - At each position the leftmost match wins, if multiple patterns start there the longest one wins.
+  //!        - The replacement text is never rescanned.
+  //!        - If a pattern occurs more than once in the set the first entry is used.
+  class StringReplacer
+  {
+    //! The automaton of the reversed patterns, the pattern indices are indices into m_replacements
+    PatternAutomaton m_reversedPatterns;
+    std::vector<std::pair<std::string, std::string>> m_replacements;
+
+  public:
+    //! @param replacements a list of (pattern, replacement) pairs, empty patterns are not allowed.
+    explicit StringReplacer(const std::vector<std::pair<std::string, std::string>>& replacements);
+
+    //! @brief Replace all pattern occurrences in 'src' and return the result.
+    std::string Replace(const std::string& src) const;
+  };
+
   //! @brief This is a work in progress class
   namespace StringUtil
   {
@@ -71,8 +92,14 @@ namespace Fsl
     void Replace(std::string& rSrc, const char from, const char to);
 
     //! @brief Replace all instances of the old value in str with the new value
+    //! @note  The result is built in a single pass, the replacement text is not rescanned.
     void Replace(std::string& rStr, const std::string& oldValue, const std::string& newValue);
 
+    //! @brief Replace all instances of all the patterns in one pass (see StringReplacer for the matching rules).
+    //! @param replacements a list of (pattern, replacement) pairs.
+    //! @note  Prefer a StringReplacer when the same set of replacements is applied to many strings.
+    void ReplaceAll(std::string& rStr, const std::vector<std::pair<std::string, std::string>>& replacements);
+
     //! @brief Replace all instances of the old value in str with the new value
     // static std::string Replace(const std::string& str, const std::string& oldValue, const std::string& newValue);
 
@@ -53,6 +53,24 @@ namespace Fsl
       //! @return true if the attributes could be found, false if the path couldn't be located
       static bool TryGetAttributes(const Path& path, FileAttributes& rAttributes);
 
+      //! @brief get the size and last write time of a file
+      //! @param rLastWriteTime a platform specific time stamp, its only meant to be compared against other values from this method.
+      //! @return true if the status could be retrieved, false if the file couldn't be located
+      static bool TryGetFileStatus(const Path& path, uint64_t& rSize, uint64_t& rLastWriteTime);
+
+      //! @brief Move a file, if the destination exists its replaced.
+      //!        The move is atomic if both files are located on the same volume.
+      //! @throws IOException if the file couldn't be moved
+      static void Move(const Path& sourceFileName, const Path& destFileName);
+
+      //! @brief Try to delete a file
+      //! @return true if the file was deleted
+      static bool TryDelete(const Path& path);
+
+      //! @brief Try to delete a empty directory
+      //! @return true if the directory was deleted
+      static bool TryDeleteDir(const Path& path);
+
       //! @brief Create a platform specific token that can be used to monitor a path for changes
       //! @return return the platform specific token or null if not supported
       //! @note Experimental interface, might change.
@@ -0,0 +1,105 @@
+#ifndef MB_ASYNCFILEWRITER_HPP
+#define MB_ASYNCFILEWRITER_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace MB
+{
+  class OutputManifest;
+
+  //! @brief Writes files on a small pool of background threads so the generating thread never blocks on the disk.
+  //!        Each file is written through IOUtil::WriteAllTextIfChangedNow so it's replaced atomically.
+  //!        Errors are collected and reported by Join.
+  //!        The writes are tracked per output manifest, so parallel jobs can wait for their own writes without waiting on each other.
+  class AsyncFileWriter
+  {
+    struct WriteJob
+    {
+      Fsl::IO::Path FileName;
+      std::string Content;
+      //! The profiler job of the thread that queued the write
+      std::string ProfileJob;
+      //! The manifest the file belongs to (can be null)
+      const OutputManifest* pManifest;
+
+      WriteJob(const Fsl::IO::Path& fileName, std::string&& content, const std::string& profileJob, const OutputManifest* const pOutputManifest)
+        : FileName(fileName)
+        , Content(std::move(content))
+        , ProfileJob(profileJob)
+        , pManifest(pOutputManifest)
+      {
+      }
+    };
+
+    std::mutex m_mutex;
+    std::condition_variable m_jobAvailable;
+    std::condition_variable m_idle;
+    std::deque<WriteJob> m_jobs;
+    std::size_t m_activeJobs;
+    bool m_quit;
+    //! The directories that have been created by this writer, so each directory is only created once
+    std::unordered_set<std::string> m_createdDirectories;
+    //! The number of queued or active writes per manifest
+    std::unordered_map<const OutputManifest*, std::size_t> m_pendingWrites;
+    std::vector<std::pair<const OutputManifest*, std::string>> m_errors;
+    std::vector<std::thread> m_threads;
+
+  public:
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    //! @param workerCount the number of I/O threads (0 = use the default)
+    explicit AsyncFileWriter(const uint32_t workerCount = 0);
+    //! @brief Waits for all pending writes, errors that weren't reported by Join are logged
+    ~AsyncFileWriter();
+
+    //! @brief Queue the content for writing, the directory of the file is created if it doesn't exist
+    //! @param pManifest the output manifest the file belongs to (can be null)
+    void Enqueue(const Fsl::IO::Path& fileName, std::string&& content, const OutputManifest* const pManifest = nullptr);
+
+    //! @brief Wait for all queued writes to complete
+    //! @throws std::runtime_error describing all writes that failed since the last join
+    void Join();
+
+    //! @brief Wait for the queued writes that belong to the manifest to complete
+    //! @throws std::runtime_error describing the writes of the manifest that failed since the last join
+    void Join(const OutputManifest* const pManifest);
+
+  private:
+    void WorkerMain();
+    static void ThrowOnErrors(const std::vector<std::string>& errors);
+    void EnsureDirectory(const Fsl::IO::Path& fileName);
+  };
+}
+#endif
@@ -0,0 +1,76 @@
+#ifndef MB_BENCHMARK_PIPELINEBENCHMARK_HPP
+#define MB_BENCHMARK_PIPELINEBENCHMARK_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Profiler.hpp>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace MB
+{
+  //! @brief The measurements of one end-to-end run of a job
+  struct PipelineBenchmarkSample
+  {
+    //! The wall time of the capture stage in microseconds
+    uint64_t CaptureWallTime;
+    //! The wall time of the generation stage in microseconds
+    uint64_t GenerateWallTime;
+    //! The number of functions, structs and enums captured
+    uint64_t SymbolCount;
+    //! The resident set size of the process after the capture stage
+    uint64_t ResidentSetSizeAfterCapture;
+    //! The resident set size of the process after the generation stage
+    uint64_t ResidentSetSizeAfterGenerate;
+    //! The peak resident set size of the process so far, it covers every earlier run as well
+    uint64_t ProcessPeakResidentSetSize;
+    //! The profiler phase totals of the run
+    ProfilePhaseTotals PhaseTotals;
+
+    PipelineBenchmarkSample()
+      : CaptureWallTime(0)
+      , GenerateWallTime(0)
+      , SymbolCount(0)
+      , ResidentSetSizeAfterCapture(0)
+      , ResidentSetSizeAfterGenerate(0)
+      , ProcessPeakResidentSetSize(0)
+    {
+    }
+  };
+
+
+  //! @brief Collects the samples of repeated end-to-end runs and reports the time, throughput and memory of each stage per job
+  class PipelineBenchmark
+  {
+    std::vector<std::string> m_jobNames;
+    std::map<std::string, std::vector<PipelineBenchmarkSample>> m_samples;
+
+  public:
+    void AddSample(const std::string& jobName, const PipelineBenchmarkSample& sample);
+
+    void Report(std::ostream& rStream) const;
+  };
+}
+#endif
@@ -26,10 +26,14 @@
 #include <RAIIGen/EnumRecord.hpp>
 #include <RAIIGen/FunctionRecord.hpp>
 #include <RAIIGen/FunctionErrors.hpp>
+#include <RAIIGen/PatternTrie.hpp>
+#include <RAIIGen/ReadOnlySpan.hpp>
 #include <RAIIGen/StructRecord.hpp>
+#include <RAIIGen/SymbolIndex.hpp>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <clang-c/Index.h>
 
 
@@ -64,19 +68,26 @@ namespace MB
     };
 
     CaptureConfig m_config;
+    //! The function name filters of the config compiled into a prefix trie
+    PatternTrie m_filters;
     std::size_t m_level;
-    std::deque<FunctionRecord> m_records;
+    std::vector<FunctionRecord> m_records;
     std::deque<FunctionErrors> m_functionErrors;
-    std::deque<StructRecord> m_structsInCapturedOrder;
+    std::vector<StructRecord> m_structsInCapturedOrder;
     std::unordered_map<std::string, StructRecord> m_structs;
     std::unordered_map<std::string, EnumRecord> m_enums;
     std::deque<CaptureInfo> m_captureInfo;
     std::deque<StructRecord> m_captureStructs;
     std::deque<EnumRecord> m_captureEnums;
     std::shared_ptr<CustomLog> m_log;
+    //! Maps a function name to its index in m_records
+    SymbolIndex m_functionIndex;
 
   public:
     Capture(const CaptureConfig& config, CXCursor rootCursor, const std::shared_ptr<CustomLog>& log);
+    //! @brief Restore a capture from previously captured records (used by the CaptureCache)
+    Capture(const CaptureConfig& config, std::vector<FunctionRecord>&& functions, std::vector<StructRecord>&& structsInCapturedOrder,
+            std::unordered_map<std::string, StructRecord>&& structs, std::unordered_map<std::string, EnumRecord>&& enums);
     ~Capture();
     CXChildVisitResult OnVisit(CXCursor cursor, CXCursor parent);
 
@@ -105,23 +116,53 @@ namespace MB
     }
 
 
-    const std::deque<FunctionRecord>& GetFunctions() const
+    //! @brief Get a view of all captured functions in captured order
+    ReadOnlySpan<FunctionRecord> GetFunctions() const
     {
-      return m_records;
+      return ReadOnlySpan<FunctionRecord>(m_records);
     }
 
-    std::deque<FunctionRecord>& DirectAccessFunctions()
+    //! @note The function name index is built when the capture completes, so the functions can be modified but not added, removed or renamed.
+    std::vector<FunctionRecord>& DirectAccessFunctions()
     {
       return m_records;
     }
 
+    //! @brief Lookup a function by name
+    //! @return the function or null if not found
+    const FunctionRecord* TryGetFunction(const Symbol& name) const
+    {
+      const auto index = m_functionIndex.Find(name);
+      return index != SymbolIndex::InvalidIndex ? &m_records[index] : nullptr;
+    }
+
 
-    const std::deque<StructRecord>& GetStructs() const
+    //! @brief Get a view of all captured structs in captured order
+    ReadOnlySpan<StructRecord> GetStructs() const
     {
-      return m_structsInCapturedOrder;
+      return ReadOnlySpan<StructRecord>(m_structsInCapturedOrder);
+    }
+
+    //! @brief Lookup a struct by name
+    //! @return the struct or null if not found
+    const StructRecord* TryGetStruct(const std::string& name) const
+    {
+      const auto itrFind = m_structs.find(name);
+      return itrFind != m_structs.end() ? &itrFind->second : nullptr;
+    }
+
+    //! @brief Lookup a enum by name
+    //! @return the enum or null if not found
+    const EnumRecord* TryGetEnum(const std::string& name) const
+    {
+      const auto itrFind = m_enums.find(name);
+      return itrFind != m_enums.end() ? &itrFind->second : nullptr;
     }
 
-    std::deque<StructRecord>& DirectAccessStructs()
+    //! @brief Get the names of all captured enums sorted by name
+    std::vector<Symbol> GetSortedEnumNames() const;
+
+    std::vector<StructRecord>& DirectAccessStructs()
     {
       return m_structsInCapturedOrder;
     }
@@ -130,6 +171,7 @@ namespace MB
     static CXChildVisitResult VistorForwarder(CXCursor cursor, CXCursor parent, CXClientData clientData);
 
   private:
+    void BuildIndices();
   };
 }
 #endif
@@ -0,0 +1,55 @@
+#ifndef MB_CAPTURECACHE_HPP
+#define MB_CAPTURECACHE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/CaptureConfig.hpp>
+#include <RAIIGen/VersionRecord.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <memory>
+#include <vector>
+
+namespace MB
+{
+  struct BasicConfig;
+  class CapturedData;
+  class CustomLog;
+
+  //! @brief A persistent on disk cache of capture results.
+  //!        Each entry is keyed by a hash of the header content, the include paths, the clang arguments and the CaptureConfig.
+  //!        The entry also stores a content hash of every file the translation unit included, so a change to any of them triggers a reparse.
+  //! @note  It is safe to call GetOrCapture from multiple threads.
+  class CaptureCache
+  {
+    Fsl::IO::Path m_cachePath;
+
+  public:
+    //! @param cachePath the directory the cache entries are stored in (its created on demand)
+    explicit CaptureCache(const Fsl::IO::Path& cachePath);
+
+    //! @brief Restore the capture from the cache if a up to date entry exist, otherwise parse the file and store the result in the cache.
+    std::shared_ptr<CapturedData> GetOrCapture(const BasicConfig& basicConfig, const Fsl::IO::Path& filename,
+                                               const std::vector<Fsl::IO::Path>& includePaths, const CaptureConfig& captureConfig,
+                                               const std::shared_ptr<CustomLog>& customLog, const VersionRecord& version);
+  };
+}
+#endif
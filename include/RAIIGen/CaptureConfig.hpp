@@ -25,6 +25,7 @@
 #include <deque>
 #include <string>
 #include <vector>
+#include <RAIIGen/ClangParseConfig.hpp>
 #include <RAIIGen/FunctionParameterNameOverride.hpp>
 #include <RAIIGen/FunctionParameterTypeOverride.hpp>
 
@@ -37,6 +38,7 @@ namespace MB
     const std::vector<FunctionParameterNameOverride> FunctionParameterNameOverrides;
     const std::vector<FunctionParameterTypeOverride> FunctionParameterTypeOverrides;
     bool OnlyScanMainHeaderFile;
+    ClangParseConfig ParseConfig;
 
     CaptureConfig()
       : TypeNamePrefix()
@@ -44,6 +46,7 @@ namespace MB
       , FunctionParameterNameOverrides()
       , FunctionParameterTypeOverrides()
       , OnlyScanMainHeaderFile(false)
+      , ParseConfig()
     {
     }
 
@@ -55,6 +58,7 @@ namespace MB
       , FunctionParameterNameOverrides(functionParameterNameOverrides)
       , FunctionParameterTypeOverrides(functionParameterTypeOverrides)
       , OnlyScanMainHeaderFile(onlyScanMainHeaderFile)
+      , ParseConfig()
     {
     }
   };
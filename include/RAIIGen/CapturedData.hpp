@@ -32,14 +32,32 @@ namespace MB
   class CapturedData
   {
   public:
-    ClangFileData FileData;
+    Fsl::IO::Path Filename;
+    std::vector<Fsl::IO::Path> IncludePaths;
+    //! The parsed file, this is null if the capture was restored from the CaptureCache
+    std::unique_ptr<ClangFileData> FileData;
     Capture TheCapture;
     VersionRecord Version;
 
     CapturedData(const BasicConfig& basicConfig, const Fsl::IO::Path& filename, const std::vector<Fsl::IO::Path>& includePaths,
                  const MB::CaptureConfig& captureConfig, const std::shared_ptr<CustomLog>& customLog, const VersionRecord& version)
-      : FileData(basicConfig, filename, includePaths)
-      , TheCapture(captureConfig, FileData.GetRootCursor(), customLog)
+      : Filename(filename)
+      , IncludePaths(includePaths)
+      , FileData(new ClangFileData(basicConfig, filename, includePaths, captureConfig.ParseConfig))
+      , TheCapture(captureConfig, FileData->GetRootCursor(), customLog)
+      , Version(version)
+    {
+    }
+
+    //! @brief Restore previously captured data without parsing the file
+    CapturedData(const Fsl::IO::Path& filename, const std::vector<Fsl::IO::Path>& includePaths, const MB::CaptureConfig& captureConfig,
+                 std::vector<FunctionRecord>&& functions, std::vector<StructRecord>&& structsInCapturedOrder,
+                 std::unordered_map<std::string, StructRecord>&& structs, std::unordered_map<std::string, EnumRecord>&& enums,
+                 const VersionRecord& version)
+      : Filename(filename)
+      , IncludePaths(includePaths)
+      , FileData()
+      , TheCapture(captureConfig, std::move(functions), std::move(structsInCapturedOrder), std::move(structs), std::move(enums))
       , Version(version)
     {
     }
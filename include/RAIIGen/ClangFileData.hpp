@@ -23,16 +23,25 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/Generator/BasicConfig.hpp>
+#include <RAIIGen/ClangIndexPool.hpp>
+#include <RAIIGen/ClangParseConfig.hpp>
+#include <RAIIGen/Profiler.hpp>
+#include <RAIIGen/TranslationUnitCache.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <clang-c/Index.h>
 #include <deque>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 namespace MB
 {
   class ClangFileData
   {
-    CXIndex m_index;
+    //! The index the translation unit was created from, its shared with other files so it must outlive the translation unit
+    std::shared_ptr<ClangIndex> m_index;
     CXTranslationUnit m_tu;
     CXCursor m_rootCursor;
 
@@ -40,8 +49,10 @@ namespace MB
     Fsl::IO::Path Filename;
     std::vector<Fsl::IO::Path> IncludePaths;
 
-	ClangFileData(const BasicConfig& basicConfig, const Fsl::IO::Path& filename, const std::vector<Fsl::IO::Path>& includePaths)
-      : Filename(filename)
+    ClangFileData(const BasicConfig& basicConfig, const Fsl::IO::Path& filename, const std::vector<Fsl::IO::Path>& includePaths,
+                  const ClangParseConfig& parseConfig)
+      : m_tu(nullptr)
+      , Filename(filename)
       , IncludePaths(includePaths)
     {
       using namespace MB;
@@ -60,27 +71,32 @@ namespace MB
       //  //"-std=c++1y"
       //};
 
-      std::deque<std::string> clangArgsTemp;
-      for (std::size_t i = 0; i < includePaths.size(); ++i)
-      {
-        clangArgsTemp.push_back(std::string("-I") + includePaths[i].ToUTF8String());
-      }
-      clangArgsTemp.push_back("-DGL_GLEXT_PROTOTYPES");
+      const std::deque<std::string> clangArgsTemp = BuildArguments(includePaths, parseConfig);
 
       std::vector<const char*> clangArgs(clangArgsTemp.size());
       for (std::size_t i = 0; i < clangArgs.size(); ++i)
         clangArgs[i] = clangArgsTemp[i].c_str();
 
-      m_index = clang_createIndex(0, 1);
-      // m_tu = clang_createTranslationUnitFromSourceFile(m_index, filename.ToUTF8String().c_str(), static_cast<int>(clangArgs.size()),
-      // clangArgs.data(), 0, nullptr);
-      m_tu = clang_parseTranslationUnit(m_index, filename.ToUTF8String().c_str(), clangArgs.data(), static_cast<int>(clangArgs.size()), nullptr, 0,
-                                        CXTranslationUnit_None);
+      ProfileScope profileScope("Parse");
+      // Only one parse uses a index at a time, but the translation unit keeps a reference to it
+      ScopedClangIndex scopedIndex;
+      m_index = scopedIndex.Get();
 
-      if (!m_tu)
+      const unsigned parseFlags = GetParseFlags(parseConfig);
+      if (basicConfig.TranslationUnitCachePath.IsEmpty())
       {
-        std::cout << "Failed\n";
-        throw std::runtime_error("Failed to translate source file");
+        m_tu = Parse(m_index->Get(), filename, clangArgs, parseFlags);
+      }
+      else
+      {
+        const TranslationUnitCache cache(basicConfig.TranslationUnitCachePath);
+        const auto key = TranslationUnitCache::CalculateKey(filename, clangArgsTemp, parseFlags);
+        m_tu = cache.TryLoad(m_index->Get(), key);
+        if (!m_tu)
+        {
+          m_tu = Parse(m_index->Get(), filename, clangArgs, parseFlags | CXTranslationUnit_ForSerialization);
+          cache.Store(m_tu, key, GetIncludedFiles());
+        }
       }
 
       m_rootCursor = clang_getTranslationUnitCursor(m_tu);
@@ -94,12 +110,11 @@ namespace MB
     ~ClangFileData()
     {
       clang_disposeTranslationUnit(m_tu);
-      clang_disposeIndex(m_index);
     }
 
     CXIndex GetIndex() const
     {
-      return m_index;
+      return m_index->Get();
     }
 
     CXTranslationUnit GetTranslationUnit() const
@@ -111,6 +126,73 @@ namespace MB
     {
       return m_rootCursor;
     }
+
+
+    //! @brief Get the full path of every file that was part of the translation unit (including the main file)
+    std::vector<Fsl::IO::Path> GetIncludedFiles() const
+    {
+      std::vector<Fsl::IO::Path> files;
+      clang_getInclusions(m_tu, InclusionVisitor, &files);
+      return files;
+    }
+
+
+    //! @brief Build the command line arguments that are given to clang when parsing a file with the given include paths
+    static std::deque<std::string> BuildArguments(const std::vector<Fsl::IO::Path>& includePaths, const ClangParseConfig& parseConfig)
+    {
+      std::deque<std::string> clangArgs;
+      for (std::size_t i = 0; i < includePaths.size(); ++i)
+      {
+        clangArgs.push_back(std::string("-I") + includePaths[i].ToUTF8String());
+      }
+      for (const auto& define : parseConfig.Defines)
+      {
+        clangArgs.push_back(std::string("-D") + define);
+      }
+      return clangArgs;
+    }
+
+
+    //! @brief Get the clang translation unit flags that match the parse config
+    static unsigned GetParseFlags(const ClangParseConfig& parseConfig)
+    {
+      unsigned flags = CXTranslationUnit_None;
+      if (parseConfig.SkipFunctionBodies)
+        flags |= CXTranslationUnit_SkipFunctionBodies;
+      if (parseConfig.Incomplete)
+        flags |= CXTranslationUnit_Incomplete;
+#if CINDEX_VERSION >= CINDEX_VERSION_ENCODE(0, 43)
+      // Only available from clang 5.0, older versions always stop at the first fatal error and follow the includes
+      if (parseConfig.SingleFileParse)
+        flags |= CXTranslationUnit_SingleFileParse;
+      if (parseConfig.KeepGoing)
+        flags |= CXTranslationUnit_KeepGoing;
+#endif
+      return flags;
+    }
+
+  private:
+    static CXTranslationUnit Parse(CXIndex index, const Fsl::IO::Path& filename, const std::vector<const char*>& clangArgs, const unsigned parseFlags)
+    {
+      CXTranslationUnit tu = nullptr;
+      const auto errorCode = clang_parseTranslationUnit2(index, filename.ToUTF8String().c_str(), clangArgs.data(),
+                                                         static_cast<int>(clangArgs.size()), nullptr, 0, parseFlags, &tu);
+      if (errorCode != CXError_Success || !tu)
+      {
+        std::cout << "Failed\n";
+        throw std::runtime_error("Failed to translate source file '" + filename.ToUTF8String() + "' (error " + std::to_string(errorCode) + ")");
+      }
+      return tu;
+    }
+
+
+    static void InclusionVisitor(CXFile includedFile, CXSourceLocation* /*pInclusionStack*/, unsigned /*includeLength*/, CXClientData clientData)
+    {
+      auto pFiles = static_cast<std::vector<Fsl::IO::Path>*>(clientData);
+      CXString fileName = clang_getFileName(includedFile);
+      pFiles->push_back(Fsl::IO::Path(clang_getCString(fileName)));
+      clang_disposeString(fileName);
+    }
   };
 }
 
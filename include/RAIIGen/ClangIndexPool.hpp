@@ -0,0 +1,90 @@
+#ifndef MB_CLANGINDEXPOOL_HPP
+#define MB_CLANGINDEXPOOL_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <clang-c/Index.h>
+#include <memory>
+
+namespace MB
+{
+  //! @brief Owns a libclang index
+  class ClangIndex
+  {
+    CXIndex m_index;
+
+  public:
+    ClangIndex(const ClangIndex&) = delete;
+    ClangIndex& operator=(const ClangIndex&) = delete;
+
+    ClangIndex();
+    ~ClangIndex();
+
+    CXIndex Get() const
+    {
+      return m_index;
+    }
+  };
+
+
+  //! @brief The indices shared by all the files parsed during a run.
+  //!        A index is only used by one parse at a time, so concurrent parses each borrow their own and the pool only grows to the number of
+  //!        files parsed concurrently. The translation units keep a reference to the index they were created from so it outlives them.
+  //! @note  This is thread safe.
+  class ClangIndexPool
+  {
+  public:
+    //! @brief Borrow a index that no other parse is using
+    static std::shared_ptr<ClangIndex> Acquire();
+
+    //! @brief Return a index borrowed with Acquire
+    static void Release(const std::shared_ptr<ClangIndex>& index);
+  };
+
+
+  //! @brief Borrow a index from the ClangIndexPool for the lifetime of this object
+  class ScopedClangIndex
+  {
+    std::shared_ptr<ClangIndex> m_index;
+
+  public:
+    ScopedClangIndex(const ScopedClangIndex&) = delete;
+    ScopedClangIndex& operator=(const ScopedClangIndex&) = delete;
+
+    ScopedClangIndex()
+      : m_index(ClangIndexPool::Acquire())
+    {
+    }
+
+    ~ScopedClangIndex()
+    {
+      ClangIndexPool::Release(m_index);
+    }
+
+    const std::shared_ptr<ClangIndex>& Get() const
+    {
+      return m_index;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef MB_CLANGPARSECONFIG_HPP
+#define MB_CLANGPARSECONFIG_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <string>
+#include <vector>
+
+namespace MB
+{
+  //! @brief Controls how libclang parses a header.
+  //!        The Khronos headers only contain declarations so by default function bodies are skipped, the translation unit is treated as a
+  //!        incomplete header and parsing continues after errors.
+  struct ClangParseConfig
+  {
+    //! Skip the bodies of all functions (inline functions in the headers are never captured)
+    bool SkipFunctionBodies;
+    //! Parse the file as a header, this skips the semantic analysis done at the end of a complete translation unit
+    bool Incomplete;
+    //! Only parse the main file, includes are not followed so this only works for headers that are self contained
+    bool SingleFileParse;
+    //! Keep parsing after fatal errors
+    bool KeepGoing;
+    //! The preprocessor defines given to clang
+    std::vector<std::string> Defines;
+
+    ClangParseConfig()
+      : SkipFunctionBodies(true)
+      , Incomplete(true)
+      , SingleFileParse(false)
+      , KeepGoing(true)
+      , Defines()
+    {
+    }
+  };
+}
+
+#endif
@@ -23,6 +23,7 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/ParameterType.hpp>
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/TypeRecord.hpp>
 #include <RAIIGen/VersionRecord.hpp>
 #include <string>
@@ -31,7 +32,7 @@ namespace MB
 {
   struct EnumMemberRecord
   {
-    std::string Name;
+    Symbol Name;
     uint64_t UnsignedValue;
     VersionRecord Version;
 
@@ -23,16 +23,17 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/EnumMemberRecord.hpp>
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/VersionRecord.hpp>
-#include <deque>
 #include <string>
+#include <vector>
 
 namespace MB
 {
   struct EnumRecord
   {
-    std::string Name;
-    std::deque<EnumMemberRecord> Members;
+    Symbol Name;
+    std::vector<EnumMemberRecord> Members;
     VersionRecord Version;
 
     EnumRecord()
@@ -51,7 +52,7 @@ namespace MB
 
     void Clear()
     {
-      Name.clear();
+      Name = Symbol();
       Members.clear();
       Version.Clear();
     }
@@ -22,25 +22,26 @@
 //* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //***************************************************************************************************************************************************
 
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/TypeRecord.hpp>
 #include <RAIIGen/ParameterRecord.hpp>
 #include <RAIIGen/VersionRecord.hpp>
-#include <deque>
 #include <string>
+#include <vector>
 
 namespace MB
 {
   struct FunctionRecord
   {
     TypeRecord ReturnType;
-    std::string Name;
-    std::deque<ParameterRecord> Parameters;
+    Symbol Name;
+    std::vector<ParameterRecord> Parameters;
     VersionRecord Version;
 
     void Clear()
     {
       ReturnType.Clear();
-      Name.clear();
+      Name = Symbol();
       Parameters.clear();
       Version.Clear();
     }
@@ -22,7 +22,9 @@
 //* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //***************************************************************************************************************************************************
 
+#include <cstdint>
 #include <string>
+#include <FslBase/IO/Path.hpp>
 #include <RAIIGen/ProgramInfo.hpp>
 #include <RAIIGen/VersionRecord.hpp>
 
@@ -37,9 +39,17 @@ namespace MB
     std::string APIVersion;
 	// The header file version this is based upon
     VersionRecord CurrentAPIVersion;
+    //! The number of threads the generators can use (0 = use the hardware concurrency)
+    uint32_t WorkerCount;
+    //! The directory used to cache the parsed translation units (empty = disabled)
+    Fsl::IO::Path TranslationUnitCachePath;
+    //! Write the struct layout report (RAIIGenStructLayout.txt) to the output directory
+    bool WriteStructLayoutReport;
 
     BasicConfig()
       : Program()
+      , WorkerCount(0)
+      , WriteStructLayoutReport(false)
     {
     }
 
@@ -51,6 +61,8 @@ namespace MB
       , APIName(apiName)
       , APIVersion(apiVersion)
       , CurrentAPIVersion(currentAPIVersion)
+      , WorkerCount(0)
+      , WriteStructLayoutReport(false)
     {
     }
   };
@@ -0,0 +1,55 @@
+#ifndef MB_GENERATOR_BLACKLISTMATCHER_HPP
+#define MB_GENERATOR_BLACKLISTMATCHER_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/BlackListEntry.hpp>
+#include <RAIIGen/Generator/ConfigUtil.hpp>
+#include <RAIIGen/PatternTrie.hpp>
+#include <FslBase/String/PatternAutomaton.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace MB
+{
+  //! @brief A compiled set of black list rules.
+  //!        The Exact rules are kept in a hash set, all Postfix rules share a trie of the reversed postfixes and the Contains rules are
+  //!        combined into one Aho-Corasick automaton, so checking a name costs the same no matter how many rules there are.
+  //!        It matches exactly the same names as ConfigUtil::HasMatchingEntry.
+  class BlackListMatcher
+  {
+    std::vector<BlackListEntry> m_entries;
+    std::unordered_set<std::string> m_exact;
+    //! The reversed postfixes, the pattern ids are indices into m_entries
+    PatternTrie m_reversedPostfixes;
+    Fsl::PatternAutomaton m_contains;
+
+  public:
+    BlackListMatcher();
+    explicit BlackListMatcher(const std::vector<BlackListEntry>& entries);
+
+    //! @brief Check if the name matches any of the rules
+    bool IsMatch(const std::string& str, const ConfigUtil::CurrentEntityInfo& currentEntityInfo) const;
+  };
+}
+#endif
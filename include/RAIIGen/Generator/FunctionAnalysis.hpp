@@ -23,6 +23,7 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/Generator/MatchedFunctionPair.hpp>
+#include <deque>
 
 namespace MB
 {
@@ -0,0 +1,64 @@
+#ifndef MB_GENERATOR_FUNCTIONINDEX_HPP
+#define MB_GENERATOR_FUNCTIONINDEX_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/FunctionRecord.hpp>
+#include <RAIIGen/Symbol.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MB
+{
+  class Capture;
+
+  //! @brief Name based queries over the functions of a capture.
+  //!        Exact lookups use the capture's symbol index and prefix lookups use a name sorted array, so both avoid scanning all functions.
+  //! @note  The capture must outlive the index and its function list must not be modified while the index is in use.
+  class FunctionIndex
+  {
+    const Capture& m_capture;
+    //! Indices into Capture::GetFunctions sorted by function name
+    std::vector<uint32_t> m_sortedByName;
+
+  public:
+    explicit FunctionIndex(const Capture& capture);
+
+    //! @brief Lookup a function by name
+    //! @return the function or null if not found
+    const FunctionRecord* TryFind(const Symbol& name) const;
+
+    //! @brief Lookup a function by name without interning the name
+    //! @return the function or null if not found
+    const FunctionRecord* TryFind(const std::string& name) const;
+
+    //! @brief Find all functions whose name starts with the given prefix
+    //! @return indices into Capture::GetFunctions in captured order
+    std::vector<uint32_t> FindIndicesByPrefix(const std::string& prefix) const;
+
+    //! @brief Find all functions whose name starts with the given prefix
+    //! @return the functions in captured order
+    std::vector<const FunctionRecord*> FindByPrefix(const std::string& prefix) const;
+  };
+}
+#endif
@@ -25,6 +25,7 @@
 #include <RAIIGen/FunctionRecord.hpp>
 #include <RAIIGen/Generator/FunctionNamePair.hpp>
 #include <RAIIGen/Generator/FunctionAnalysis.hpp>
+#include <RAIIGen/Generator/FunctionIndex.hpp>
 #include <RAIIGen/Generator/GeneratorConfig.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <deque>
@@ -38,10 +39,10 @@ namespace MB
   {
   protected:
     FunctionAnalysis m_functionAnalysis;
+    //! Name queries over the captured functions, available to the generator passes
+    FunctionIndex m_functionIndex;
 
     Generator(const Capture& capture, const GeneratorConfig& config);
-
-    std::deque<FunctionRecord>::const_iterator FindByName(const std::deque<FunctionRecord>& records, const std::string& name);
   };
 }
 #endif
@@ -0,0 +1,74 @@
+#ifndef MB_GENERATOR_SIMPLE_CLASSSNIPPETS_HPP
+#define MB_GENERATOR_SIMPLE_CLASSSNIPPETS_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/Snippets.hpp>
+#include <cassert>
+#include <memory>
+#include <string>
+
+namespace MB
+{
+  //! @brief The snippets used to generate one class.
+  //!        It refers to the shared base snippets and only stores the entries a class overrides.
+  class ClassSnippets
+  {
+    std::shared_ptr<const Snippets> m_base;
+    std::shared_ptr<const std::string> m_resetMemberHeader;
+    std::shared_ptr<const std::string> m_resetMemberSource;
+
+  public:
+    explicit ClassSnippets(const std::shared_ptr<const Snippets>& base)
+      : m_base(base)
+    {
+      assert(m_base);
+    }
+
+    //! @param resetMemberHeader the override or null to use the base snippet
+    //! @param resetMemberSource the override or null to use the base snippet
+    ClassSnippets(const std::shared_ptr<const Snippets>& base, const std::shared_ptr<const std::string>& resetMemberHeader,
+                  const std::shared_ptr<const std::string>& resetMemberSource)
+      : m_base(base)
+      , m_resetMemberHeader(resetMemberHeader)
+      , m_resetMemberSource(resetMemberSource)
+    {
+      assert(m_base);
+    }
+
+    const Snippets& GetBase() const
+    {
+      return *m_base;
+    }
+
+    const std::string& GetResetMemberHeader() const
+    {
+      return m_resetMemberHeader ? *m_resetMemberHeader : m_base->ResetMemberHeader;
+    }
+
+    const std::string& GetResetMemberSource() const
+    {
+      return m_resetMemberSource ? *m_resetMemberSource : m_base->ResetMemberSource;
+    }
+  };
+}
+#endif
@@ -0,0 +1,241 @@
+#ifndef MB_GENERATOR_SIMPLE_COMPILEDTEMPLATE_HPP
+#define MB_GENERATOR_SIMPLE_COMPILEDTEMPLATE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MB
+{
+  //! @brief The placeholder names a group of templates is allowed to use.
+  //!        Each name is assigned a fixed slot index so rendering never has to look a name up.
+  class TemplateSchema
+  {
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, std::size_t> m_lookup;
+
+  public:
+    //! @param names the placeholder names without the '##' markers
+    TemplateSchema(std::initializer_list<const char*> names);
+
+    std::size_t Size() const
+    {
+      return m_names.size();
+    }
+
+    const std::string& GetName(const std::size_t index) const
+    {
+      return m_names[index];
+    }
+
+    bool TryGetIndex(const std::string& name, std::size_t& rIndex) const;
+
+    //! @brief Get the slot index of the given name
+    //! @throws NotFoundException if the name is not part of the schema
+    std::size_t GetIndex(const std::string& name) const;
+  };
+
+
+  class CompiledTemplate;
+  class CompiledTemplateCache;
+
+  //! @brief The placeholder->value table used to render a CompiledTemplate.
+  class TemplateValues
+  {
+    struct Entry
+    {
+      std::string Value;
+      //! The compiled value if it was set with SetExpanded and contains placeholders
+      std::shared_ptr<const CompiledTemplate> Expansion;
+      bool IsSet;
+      bool IsOptional;
+
+      Entry()
+        : IsSet(false)
+        , IsOptional(false)
+      {
+      }
+    };
+
+    const TemplateSchema* m_pSchema;
+    CompiledTemplateCache* m_pCache;
+    std::vector<Entry> m_entries;
+
+  public:
+    explicit TemplateValues(const TemplateSchema& schema);
+
+    //! @brief The expanded values are compiled through the cache so a value text that repeats is only parsed once.
+    //! @throws std::invalid_argument if the cache was created for a different schema
+    TemplateValues(const TemplateSchema& schema, CompiledTemplateCache& rCache);
+
+    //! @brief Set the value of a placeholder
+    //! @throws NotFoundException if the placeholder is not part of the schema (so no template could ever use it)
+    void Set(const std::string& name, const std::string& value);
+
+    //! @brief Set a value that a template is free to ignore, it's never reported by UnusedTemplateValues::Error.
+    //!        Used for the general values (like the API name) that are offered to every template in a set.
+    void SetOptional(const std::string& name, const std::string& value);
+
+    //! @brief Set a value that itself contains placeholders, they are resolved against this table when rendered.
+    //! @note  The placeholders inside the value are substituted with the raw values, they are not expanded any further.
+    //! @throws std::runtime_error if the value uses a placeholder that is unknown to the schema
+    void SetExpanded(const std::string& name, const std::string& value);
+
+    const TemplateSchema& GetSchema() const
+    {
+      return *m_pSchema;
+    }
+
+    bool IsSet(const std::size_t index) const
+    {
+      return m_entries[index].IsSet;
+    }
+
+    bool IsOptional(const std::size_t index) const
+    {
+      return m_entries[index].IsOptional;
+    }
+
+    bool IsExpanded(const std::size_t index) const
+    {
+      return m_entries[index].Expansion != nullptr;
+    }
+
+    const std::string& GetValue(const std::size_t index) const
+    {
+      return m_entries[index].Value;
+    }
+
+    //! @brief Get the compiled value of a expanded slot
+    const CompiledTemplate& GetExpansion(const std::size_t index) const
+    {
+      return *m_entries[index].Expansion;
+    }
+  };
+
+
+  //! @brief How CompiledTemplate::Render treats values that the template never references
+  enum class UnusedTemplateValues
+  {
+    //! Unreferenced values are ignored, so one value table can be shared by several templates (like a header and source pair)
+    Allow,
+    //! Unreferenced values are reported as a error
+    Error
+  };
+
+
+  //! @brief A template that has been parsed into literal segments and placeholder slots.
+  //!        A placeholder is written as ##NAME## where NAME consists of 'A'-'Z', '0'-'9', '_' and '!'.
+  //!        Any other use of '##' is treated as literal text.
+  class CompiledTemplate
+  {
+    struct Segment
+    {
+      std::size_t Offset;
+      std::size_t Length;
+      //! The schema slot index or InvalidSlot for a literal segment
+      std::size_t Slot;
+
+      Segment(const std::size_t offset, const std::size_t length, const std::size_t slot)
+        : Offset(offset)
+        , Length(length)
+        , Slot(slot)
+      {
+      }
+    };
+
+    std::string m_name;
+    std::string m_text;
+    std::size_t m_schemaSize;
+    std::vector<Segment> m_segments;
+    //! The schema slots that the template references
+    std::vector<bool> m_referencedSlots;
+    std::size_t m_literalLength;
+
+  public:
+    static const std::size_t InvalidSlot = static_cast<std::size_t>(-1);
+
+    CompiledTemplate();
+
+    //! @brief Parse the text
+    //! @param name a user friendly name (like the filename) used in error messages
+    //! @throws std::runtime_error if the template uses a placeholder that is unknown to the schema
+    CompiledTemplate(const std::string& name, const std::string& text, const TemplateSchema& schema);
+
+    const std::string& GetName() const
+    {
+      return m_name;
+    }
+
+    bool IsEmpty() const
+    {
+      return m_text.empty();
+    }
+
+    //! @brief Check if the template references the schema slot
+    bool IsReferenced(const std::size_t slot) const
+    {
+      return slot < m_referencedSlots.size() && m_referencedSlots[slot];
+    }
+
+    //! @brief Get the names of the non optional placeholders that have a value but aren't referenced by the template or any of the expanded
+    //!        values it uses
+    std::vector<std::string> GetUnusedValueNames(const TemplateValues& values) const;
+
+    //! @brief Render the template in a single pass.
+    //! @throws std::runtime_error if a referenced placeholder has no value or if unusedValues is Error and a non optional value isn't referenced
+    std::string Render(const TemplateValues& values, const UnusedTemplateValues unusedValues = UnusedTemplateValues::Allow) const;
+
+  private:
+    std::string RenderValues(const TemplateValues& values, const bool allowExpand) const;
+  };
+
+
+  //! @brief Compiles each distinct expanded value text once, so the values that repeat between the rendered classes are only parsed once.
+  //!        Safe to use from multiple threads.
+  class CompiledTemplateCache
+  {
+    const TemplateSchema* m_pSchema;
+    std::mutex m_lock;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledTemplate>> m_templates;
+
+  public:
+    explicit CompiledTemplateCache(const TemplateSchema& schema);
+
+    const TemplateSchema& GetSchema() const
+    {
+      return *m_pSchema;
+    }
+
+    //! @brief Get the compiled version of the text, compiling it on first use
+    //! @param name a user friendly name used in error messages if the text has to be compiled
+    //! @throws std::runtime_error if the text uses a placeholder that is unknown to the schema
+    std::shared_ptr<const CompiledTemplate> Get(const std::string& name, const std::string& text);
+  };
+}
+#endif
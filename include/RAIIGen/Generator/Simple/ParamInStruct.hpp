@@ -31,11 +31,12 @@ namespace MB
   struct ParamInStruct
   {
     MethodArgument SourceParameter;
-    StructRecord SourceStruct;
+    //! Points to the record stored in the capture
+    const StructRecord* pSourceStruct;
     MemberRecord StructMember;
     ParamInStruct(const MethodArgument& sourceParameter, const StructRecord& sourceStruct, const MemberRecord& structMember)
       : SourceParameter(sourceParameter)
-      , SourceStruct(sourceStruct)
+      , pSourceStruct(&sourceStruct)
       , StructMember(structMember)
     {
     }
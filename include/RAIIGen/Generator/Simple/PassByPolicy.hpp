@@ -0,0 +1,109 @@
+#ifndef MB_GENERATOR_SIMPLE_PASSBYPOLICY_HPP
+#define MB_GENERATOR_SIMPLE_PASSBYPOLICY_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/MemberVariable.hpp>
+#include <RAIIGen/TypeRecord.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace MB
+{
+  enum class PassBy
+  {
+    Value,
+    ConstReference,
+    RValueReference
+  };
+
+
+  struct PassByPolicyConfig
+  {
+    //! Trivially copyable values up to this size in bytes are passed by value, larger ones by const reference.
+    //! The default matches the largest aggregate the common 64 bit calling conventions pass in registers.
+    int64_t MaxPassByValueSize;
+    //! Arguments whose type name starts with one of these are sinks and are passed by rvalue reference so they can be moved from.
+    //! Defaults to std::vector, which the vector templates use to store multiple resources.
+    std::vector<std::string> SinkTypePrefixes;
+
+    PassByPolicyConfig()
+      : MaxPassByValueSize(16)
+      , SinkTypePrefixes({"std::vector<"})
+    {
+    }
+
+    PassByPolicyConfig(const int64_t maxPassByValueSize, const std::vector<std::string>& sinkTypePrefixes)
+      : MaxPassByValueSize(maxPassByValueSize)
+      , SinkTypePrefixes(sinkTypePrefixes)
+    {
+    }
+  };
+
+
+  //! @brief Decides how the generated wrappers take their arguments based on the captured type sizes
+  class PassByPolicy
+  {
+    PassByPolicyConfig m_config;
+
+  public:
+    PassByPolicy();
+    explicit PassByPolicy(const PassByPolicyConfig& config);
+
+    const PassByPolicyConfig& GetConfig() const
+    {
+      return m_config;
+    }
+
+    //! @brief Decide how a argument of the given (non pointer) type is passed
+    PassBy Decide(const TypeRecord& type) const;
+
+    //! @brief Decide how the struct pointed to by a const struct pointer argument is passed when the pointer is converted to a C++ argument.
+    //!        It's only passed by value if it's a small trivially copyable type, otherwise it's passed by const reference.
+    PassBy DecidePointee(const TypeRecord& pointerType) const;
+
+    //! @brief Get the type string of a argument of the given (non pointer) type
+    std::string GetArgumentTypeString(const TypeRecord& type) const;
+
+    //! @brief Get the type string used when a const struct pointer argument is converted to a C++ argument
+    std::string GetPointeeArgumentTypeString(const TypeRecord& pointerType) const;
+
+    //! @brief Get the expression used to pass a argument of the given (non pointer) type on, sinks are moved
+    std::string GetArgumentValue(const TypeRecord& type, const std::string& argumentName) const;
+
+    //! @brief Decide how a parameter that initializes the member variable is passed
+    PassBy DecideMember(const MemberVariable& member) const;
+
+    //! @brief Get the type string of a parameter that initializes the member variable
+    std::string GetMemberArgumentTypeString(const MemberVariable& member) const;
+
+    //! @brief Get the expression used to pass a parameter that initializes the member variable on, sinks are moved
+    std::string GetMemberArgumentValue(const MemberVariable& member) const;
+
+  private:
+    bool IsSink(const std::string& typeName) const;
+    static std::string ToArgumentValue(const PassBy passBy, const std::string& argumentName);
+    PassBy DecideBySize(const int64_t size) const;
+  };
+}
+#endif
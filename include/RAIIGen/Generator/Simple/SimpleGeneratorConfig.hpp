@@ -23,11 +23,13 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/Generator/BlackListEntry.hpp>
+#include <RAIIGen/Generator/BlackListMatcher.hpp>
 #include <RAIIGen/Generator/ClassFunctionAbsorb.hpp>
 #include <RAIIGen/Generator/FunctionGuard.hpp>
 #include <RAIIGen/Generator/GeneratorConfig.hpp>
 #include <RAIIGen/Generator/RAIIClassCustomization.hpp>
 #include <RAIIGen/Generator/RAIIClassMethodOverrides.hpp>
+#include <RAIIGen/Generator/Simple/PassByPolicy.hpp>
 #include <RAIIGen/Generator/Simple/VersionGuardConfig.hpp>
 #include <RAIIGen/Generator/TypeNameAliasEntry.hpp>
 #include <unordered_map>
@@ -45,6 +47,10 @@ namespace MB
     const std::vector<BlackListEntry> FunctionNameBlacklist;
     const std::vector<BlackListEntry> EnumNameBlacklist;
     const std::vector<BlackListEntry> EnumMemberBlacklist;
+    //! The black lists above compiled for fast matching
+    const BlackListMatcher FunctionNameBlacklistMatcher;
+    const BlackListMatcher EnumNameBlacklistMatcher;
+    const BlackListMatcher EnumMemberBlacklistMatcher;
     const std::unordered_map<std::string, std::string> TypeNameAliases;
     const std::string TypeNamePrefix;
     const std::string FunctionNamePrefix;
@@ -53,6 +59,8 @@ namespace MB
     const bool OwnershipTransferUseClaimMode;
     const VersionGuardConfig VersionGuard;
     const bool IsVulkan;
+    //! Decides how the generated wrapper methods take their arguments
+    const PassByPolicy ArgumentPassing;
 
     SimpleGeneratorConfig()
       : UnrollCreateStructs(false)
@@ -72,7 +80,8 @@ namespace MB
                           const std::vector<TypeNameAliasEntry>& typeNameAliases,
                           const std::string& typeNamePrefix, const std::string& functionNamePrefix, const std::string& errorCodeTypeName,
                           const bool unrollCreateStructs, const bool ownershipTransferUseClaimMode,
-                          const VersionGuardConfig versionGuard = VersionGuardConfig(), const bool isVulkan = false)
+                          const VersionGuardConfig versionGuard = VersionGuardConfig(), const bool isVulkan = false,
+                          const PassByPolicyConfig& passByPolicyConfig = PassByPolicyConfig())
       : GeneratorConfig(config)
       , RAIIClassCustomizations(raiiClassCustomizations)
       , ClassFunctionAbsorbtion(classFunctionAbsorbtion)
@@ -83,6 +92,9 @@ namespace MB
       , FunctionNameBlacklist(functionNameBlacklist)
       , EnumNameBlacklist(enumNameBlacklist)
       , EnumMemberBlacklist(enumMemberBlacklist)
+      , FunctionNameBlacklistMatcher(functionNameBlacklist)
+      , EnumNameBlacklistMatcher(enumNameBlacklist)
+      , EnumMemberBlacklistMatcher(enumMemberBlacklist)
       , TypeNameAliases(GenerateAliases(typeNameAliases))
       , TypeNamePrefix(typeNamePrefix)
       , FunctionNamePrefix(functionNamePrefix)
@@ -91,6 +103,7 @@ namespace MB
       , OwnershipTransferUseClaimMode(ownershipTransferUseClaimMode)
       , VersionGuard(versionGuard)
       , IsVulkan(isVulkan)
+      , ArgumentPassing(passByPolicyConfig)
     {
     }
 
@@ -105,7 +118,8 @@ namespace MB
                           const std::vector<TypeNameAliasEntry>& typeNameAliases, const std::string& typeNamePrefix,
                           const std::string& functionNamePrefix, const std::string& errorCodeTypeName,
                           const bool unrollCreateStructs, const bool ownershipTransferUseClaimMode,
-                          const VersionGuardConfig versionGuard = VersionGuardConfig(), const bool isVulkan = false)
+                          const VersionGuardConfig versionGuard = VersionGuardConfig(), const bool isVulkan = false,
+                          const PassByPolicyConfig& passByPolicyConfig = PassByPolicyConfig())
       : GeneratorConfig(basicConfig, functionPairs, manualFunctionMatches)
       , RAIIClassCustomizations(raiiClassCustomizations)
       , ClassFunctionAbsorbtion(classFunctionAbsorbtion)
@@ -116,6 +130,9 @@ namespace MB
       , FunctionNameBlacklist(functionNameBlacklist)
       , EnumNameBlacklist(enumNameBlacklist)
       , EnumMemberBlacklist(enumMemberBlacklist)
+      , FunctionNameBlacklistMatcher(functionNameBlacklist)
+      , EnumNameBlacklistMatcher(enumNameBlacklist)
+      , EnumMemberBlacklistMatcher(enumMemberBlacklist)
       , TypeNameAliases(GenerateAliases(typeNameAliases))
       , TypeNamePrefix(typeNamePrefix)
       , FunctionNamePrefix(functionNamePrefix)
@@ -124,6 +141,7 @@ namespace MB
       , OwnershipTransferUseClaimMode(ownershipTransferUseClaimMode)
       , VersionGuard(versionGuard)
       , IsVulkan(isVulkan)
+      , ArgumentPassing(passByPolicyConfig)
     {
     }
 
@@ -0,0 +1,70 @@
+#ifndef MB_GENERATOR_SIMPLE_SNIPPETSTORE_HPP
+#define MB_GENERATOR_SIMPLE_SNIPPETSTORE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <RAIIGen/Generator/Simple/Snippets.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace MB
+{
+  //! @brief The immutable snippets of a template root.
+  //!        A store is loaded once per template root and shared by every generator that uses the root.
+  class SnippetStore
+  {
+    Fsl::IO::Path m_templateRoot;
+    std::shared_ptr<const Snippets> m_snippets;
+    mutable std::mutex m_lock;
+    mutable std::unordered_map<std::string, std::shared_ptr<const std::string>> m_files;
+
+  public:
+    //! @brief Load all the snippets of the template root
+    explicit SnippetStore(const Fsl::IO::Path& templateRoot);
+
+    SnippetStore(const SnippetStore&) = delete;
+    SnippetStore& operator=(const SnippetStore&) = delete;
+
+    //! @brief Get the shared store for the template root, it is loaded on first use.
+    static std::shared_ptr<const SnippetStore> Get(const Fsl::IO::Path& templateRoot);
+
+    //! @brief Forget all the cached stores so the next Get reloads the files (existing references stay valid).
+    static void ClearCache();
+
+    const Fsl::IO::Path& GetTemplateRoot() const
+    {
+      return m_templateRoot;
+    }
+
+    const std::shared_ptr<const Snippets>& GetSnippets() const
+    {
+      return m_snippets;
+    }
+
+    //! @brief Get the content of a additional snippet file relative to the template root, each file is only read once.
+    std::shared_ptr<const std::string> GetFile(const std::string& relativePath) const;
+  };
+}
+#endif
@@ -0,0 +1,48 @@
+#ifndef MB_GENERATOR_SIMPLE_STRUCT_STRUCTLAYOUTREPORT_HPP
+#define MB_GENERATOR_SIMPLE_STRUCT_STRUCTLAYOUTREPORT_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <cstdint>
+
+namespace MB
+{
+  class Capture;
+  struct StructRecord;
+
+  //! @brief Generates a report of the padding in every captured struct, ranked so the structs that waste the most bytes come first.
+  class StructLayoutReport
+  {
+  public:
+    static const int64_t CacheLineSize = 64;
+
+    static void Process(const Capture& capture, const Fsl::IO::Path& dstFileName);
+
+    //! @brief Check if the captured layout of the struct and all its members is known
+    static bool HasKnownLayout(const StructRecord& record);
+
+    //! @brief Get the pointer size of the capture target, zero if no captured struct contains a pointer
+    static int64_t FindPointerSize(const Capture& capture);
+  };
+}
+#endif
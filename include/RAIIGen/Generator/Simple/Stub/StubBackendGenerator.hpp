@@ -0,0 +1,44 @@
+#ifndef MB_GENERATOR_SIMPLE_STUB_STUBBACKENDGENERATOR_HPP
+#define MB_GENERATOR_SIMPLE_STUB_STUBBACKENDGENERATOR_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <RAIIGen/Generator/FunctionAnalysis.hpp>
+#include <RAIIGen/Generator/Simple/SimpleGeneratorConfig.hpp>
+
+namespace MB
+{
+  class Capture;
+
+  //! @brief Generates a stub implementation of every captured entry point so the generated classes can be tested without a driver.
+  //!        Create functions hand out unique fake handles, destroy functions validate and count them and everything else is a no-op
+  //!        unless a hook is installed for it. The stub runtime lives in the 'stub' templates, only the entry points are generated.
+  class StubBackendGenerator
+  {
+  public:
+    //! @brief Generate 'StubBackend.hpp' and 'StubBackend.cpp' in dstPath if the templateRoot contains the stub templates
+    static void Process(const Capture& capture, const SimpleGeneratorConfig& config, const FunctionAnalysis& functionAnalysis,
+                        const Fsl::IO::Path& templateRoot, const Fsl::IO::Path& dstPath);
+  };
+}
+#endif
@@ -0,0 +1,90 @@
+#ifndef MB_HASHUTIL_HPP
+#define MB_HASHUTIL_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/CaptureConfig.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <cstdint>
+#include <string>
+
+namespace MB
+{
+  //! 64 bit FNV-1a, used to detect changes in the inputs. Its not a cryptographic hash.
+  class Fnv1aHasher
+  {
+    uint64_t m_hash;
+
+  public:
+    Fnv1aHasher()
+      : m_hash(14695981039346656037ULL)
+    {
+    }
+
+    void Add(const uint8_t* pData, const std::size_t size)
+    {
+      for (std::size_t i = 0; i < size; ++i)
+      {
+        m_hash ^= pData[i];
+        m_hash *= 1099511628211ULL;
+      }
+    }
+
+    void Add(const uint64_t value)
+    {
+      for (std::size_t i = 0; i < 8; ++i)
+      {
+        const auto byte = static_cast<uint8_t>((value >> (i * 8)) & 0xFF);
+        Add(&byte, 1);
+      }
+    }
+
+    void Add(const std::string& value)
+    {
+      Add(static_cast<uint64_t>(value.size()));
+      Add(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+    }
+
+    uint64_t GetHash() const
+    {
+      return m_hash;
+    }
+  };
+
+
+  class HashUtil
+  {
+  public:
+    //! @brief Hash the content of the given file
+    static uint64_t HashFileContent(const Fsl::IO::Path& path);
+
+    //! @brief Hash the name and content of every file in the directory and its sub directories
+    static uint64_t HashDirectoryContent(const Fsl::IO::Path& path);
+
+    //! @brief Add all the settings that affect the capture result to the hash
+    static void AddCaptureConfig(Fnv1aHasher& rHasher, const CaptureConfig& captureConfig);
+
+    //! @brief Add all the settings that affect how clang parses a file to the hash
+    static void AddParseConfig(Fnv1aHasher& rHasher, const ClangParseConfig& parseConfig);
+  };
+}
+#endif
@@ -0,0 +1,64 @@
+#ifndef MB_HISTORYDELTA_HPP
+#define MB_HISTORYDELTA_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/VersionRecord.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace MB
+{
+  class Capture;
+
+  //! @brief A compact copy of the symbol names of a single captured version, so the symbols added by a version can be found without keeping
+  //!        the full capture (and its translation unit) alive.
+  struct HistorySnapshot
+  {
+    std::unordered_set<std::string> Structs;
+    std::unordered_set<std::string> Functions;
+    std::unordered_set<std::string> Enums;
+    //! enum name -> member names
+    std::unordered_map<std::string, std::unordered_set<std::string>> EnumMembers;
+
+    HistorySnapshot();
+    explicit HistorySnapshot(const Capture& capture);
+  };
+
+
+  //! @brief The symbols that were added between two consecutive versions, this is all the VersionIndex needs to find the first appearance
+  //!        of every symbol. The names are sorted so the result doesn't depend on the hash set iteration order.
+  struct HistoryDelta
+  {
+    VersionRecord Version;
+    std::vector<std::string> Structs;
+    std::vector<std::string> Functions;
+    std::vector<std::string> Enums;
+    //! enum name -> the names of the members it gained
+    std::unordered_map<std::string, std::vector<std::string>> EnumMembers;
+
+    HistoryDelta(const HistorySnapshot& previous, const HistorySnapshot& current, const VersionRecord& version);
+  };
+}
+#endif
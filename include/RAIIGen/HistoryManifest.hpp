@@ -0,0 +1,74 @@
+#ifndef MB_HISTORYMANIFEST_HPP
+#define MB_HISTORYMANIFEST_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/VersionIndex.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace MB
+{
+  struct HistoryManifestEntry
+  {
+    //! The name of the history directory
+    std::string Name;
+    //! The hash of the directory content at the time it was captured
+    uint64_t ContentHash;
+
+    HistoryManifestEntry()
+      : Name()
+      , ContentHash(0)
+    {
+    }
+
+    HistoryManifestEntry(const std::string& name, const uint64_t contentHash)
+      : Name(name)
+      , ContentHash(contentHash)
+    {
+    }
+  };
+
+
+  //! @brief Records which API history versions have been captured and the first appearance data that was derived from them.
+  //!        This allows a rerun to only capture the history versions that were added since the last run.
+  class HistoryManifest
+  {
+  public:
+    //! A hash of the settings that affect the capture, the manifest can only be reused if this matches
+    uint64_t ConfigHash;
+    //! The captured history versions sorted from oldest to newest
+    std::deque<HistoryManifestEntry> Entries;
+    VersionIndex Index;
+
+    HistoryManifest();
+    explicit HistoryManifest(const uint64_t configHash);
+
+    //! @brief Try to load the manifest, returns false if the file doesn't exist or isn't a valid manifest
+    static bool TryLoad(HistoryManifest& rManifest, const Fsl::IO::Path& path);
+
+    void Save(const Fsl::IO::Path& path) const;
+  };
+}
+#endif
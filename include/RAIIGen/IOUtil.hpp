@@ -22,15 +22,91 @@
 //* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //***************************************************************************************************************************************************
 
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <vector>
 #include <FslBase/IO/Path.hpp>
 
 namespace MB
 {
+  class AsyncFileWriter;
+  class OutputManifest;
+
   class IOUtil
   {
   public:
+    //! @brief Write the content to the file unless it already contains it, the directory of the file is created if it doesn't exist.
+    //!        If a async file writer is registered the write is queued and performed by it.
+    //!        If the file is located below the root of a registered output manifest the manifest is used to detect unchanged files.
     static void WriteAllTextIfChanged(const Fsl::IO::Path& fileName, const std::string& content);
+    static void WriteAllTextIfChanged(const Fsl::IO::Path& fileName, std::string&& content);
+
+    //! @brief Write the content to the file on the calling thread unless it already contains it.
+    static void WriteAllTextIfChangedNow(const Fsl::IO::Path& fileName, const std::string& content);
+
+    //! @brief Write the content to a temporary file and then move it into place, so a partially written file never appears.
+    static void WriteAllTextAtomic(const Fsl::IO::Path& fileName, const std::string& content);
+    static void WriteAllBytesAtomic(const Fsl::IO::Path& fileName, const std::vector<uint8_t>& content);
+
+    //! @brief Wait for all writes queued on the registered async file writer (if any)
+    //! @throws std::runtime_error if any of the writes failed
+    static void FlushWrites();
+
+    //! @brief Wait for the writes of files that belong to the manifest queued on the registered async file writer (if any)
+    //! @throws std::runtime_error if any of those writes failed
+    static void FlushWrites(const std::shared_ptr<OutputManifest>& manifest);
+
+    static void RegisterOutputManifest(const std::shared_ptr<OutputManifest>& manifest);
+    static void UnregisterOutputManifest(const std::shared_ptr<OutputManifest>& manifest);
+
+    //! @brief Register the async file writer, only one writer can be registered at a time
+    static void RegisterAsyncFileWriter(const std::shared_ptr<AsyncFileWriter>& writer);
+    static void UnregisterAsyncFileWriter(const std::shared_ptr<AsyncFileWriter>& writer);
+  };
+
+
+  //! @brief Registers the output manifest with IOUtil for the lifetime of the object
+  class ScopedOutputManifest
+  {
+    std::shared_ptr<OutputManifest> m_manifest;
+
+  public:
+    ScopedOutputManifest(const ScopedOutputManifest&) = delete;
+    ScopedOutputManifest& operator=(const ScopedOutputManifest&) = delete;
+
+    explicit ScopedOutputManifest(const std::shared_ptr<OutputManifest>& manifest)
+      : m_manifest(manifest)
+    {
+      IOUtil::RegisterOutputManifest(m_manifest);
+    }
+
+    ~ScopedOutputManifest()
+    {
+      IOUtil::UnregisterOutputManifest(m_manifest);
+    }
+  };
+
+
+  //! @brief Registers the async file writer with IOUtil for the lifetime of the object
+  class ScopedAsyncFileWriter
+  {
+    std::shared_ptr<AsyncFileWriter> m_writer;
+
+  public:
+    ScopedAsyncFileWriter(const ScopedAsyncFileWriter&) = delete;
+    ScopedAsyncFileWriter& operator=(const ScopedAsyncFileWriter&) = delete;
+
+    explicit ScopedAsyncFileWriter(const std::shared_ptr<AsyncFileWriter>& writer)
+      : m_writer(writer)
+    {
+      IOUtil::RegisterAsyncFileWriter(m_writer);
+    }
+
+    ~ScopedAsyncFileWriter()
+    {
+      IOUtil::UnregisterAsyncFileWriter(m_writer);
+    }
   };
 }
 #endif
@@ -0,0 +1,125 @@
+#ifndef MB_JOBCONSOLE_HPP
+#define MB_JOBCONSOLE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <mutex>
+#include <streambuf>
+#include <string>
+
+namespace MB
+{
+  //! @brief Collects the console output of a job
+  //! @note  This is thread safe, so all the worker threads of a job can write to it.
+  class JobConsoleBuffer
+  {
+    std::mutex m_mutex;
+    std::string m_text;
+
+  public:
+    JobConsoleBuffer(const JobConsoleBuffer&) = delete;
+    JobConsoleBuffer& operator=(const JobConsoleBuffer&) = delete;
+
+    JobConsoleBuffer() = default;
+
+    void Append(const char* const pText, const std::size_t length);
+
+    //! @brief Get the collected text and clear the buffer
+    std::string Take();
+  };
+
+
+  //! @brief Lets jobs that run in parallel print to std::cout without their output being interleaved.
+  //!        While redirected std::cout sends the output of a thread bound to a JobConsoleBuffer to that buffer,
+  //!        the output of all other threads is written directly to the console.
+  class JobConsole
+  {
+  public:
+    //! @brief Route std::cout through the job console (this can only be done once at a time)
+    static void Redirect();
+    //! @brief Restore the original std::cout stream buffer
+    static void Restore();
+
+    //! @brief Get the buffer the calling thread is bound to (can be null)
+    static JobConsoleBuffer* GetThreadBuffer();
+    static void SetThreadBuffer(JobConsoleBuffer* const pBuffer);
+
+    //! @brief Write the text to the console in one go
+    static void Write(const std::string& text);
+  };
+
+
+  //! @brief Redirect std::cout through the job console for the lifetime of the object (if enabled)
+  class ScopedJobConsole
+  {
+    bool m_isEnabled;
+
+  public:
+    ScopedJobConsole(const ScopedJobConsole&) = delete;
+    ScopedJobConsole& operator=(const ScopedJobConsole&) = delete;
+
+    explicit ScopedJobConsole(const bool enabled)
+      : m_isEnabled(enabled)
+    {
+      if (m_isEnabled)
+        JobConsole::Redirect();
+    }
+
+    ~ScopedJobConsole()
+    {
+      if (m_isEnabled)
+        JobConsole::Restore();
+    }
+  };
+
+
+  //! @brief Bind the calling thread to a job buffer for the lifetime of the object, the buffered output is printed when it's destroyed
+  class ScopedJobConsoleBuffer
+  {
+    JobConsoleBuffer m_buffer;
+    JobConsoleBuffer* m_pPreviousBuffer;
+
+  public:
+    ScopedJobConsoleBuffer(const ScopedJobConsoleBuffer&) = delete;
+    ScopedJobConsoleBuffer& operator=(const ScopedJobConsoleBuffer&) = delete;
+
+    ScopedJobConsoleBuffer()
+      : m_pPreviousBuffer(JobConsole::GetThreadBuffer())
+    {
+      JobConsole::SetThreadBuffer(&m_buffer);
+    }
+
+    ~ScopedJobConsoleBuffer()
+    {
+      JobConsole::SetThreadBuffer(m_pPreviousBuffer);
+      const auto text = m_buffer.Take();
+      if (text.empty())
+        return;
+      // A nested job belongs to the output of the outer one
+      if (m_pPreviousBuffer != nullptr)
+        m_pPreviousBuffer->Append(text.data(), text.size());
+      else
+        JobConsole::Write(text);
+    }
+  };
+}
+#endif
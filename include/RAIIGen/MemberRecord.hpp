@@ -23,7 +23,9 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/ParameterType.hpp>
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/TypeRecord.hpp>
+#include <cstdint>
 #include <string>
 
 namespace MB
@@ -31,13 +33,19 @@ namespace MB
   struct MemberRecord
   {
     TypeRecord Type;
-    std::string Name;
-    std::string ArgumentName;
+    Symbol Name;
+    Symbol ArgumentName;
+    //! The offset of the member in its struct in bits (negative if unknown)
+    int64_t OffsetInBits;
+    //! The width of a bit field member in bits (negative if the member is not a bit field)
+    int32_t BitWidth;
 
     MemberRecord()
       : Type()
       , Name()
       , ArgumentName()
+      , OffsetInBits(-1)
+      , BitWidth(-1)
     {
     }
 
@@ -45,6 +53,8 @@ namespace MB
       : Type(type)
       , Name(name)
       , ArgumentName(name)
+      , OffsetInBits(-1)
+      , BitWidth(-1)
     {
     }
 
@@ -58,9 +68,14 @@ namespace MB
       return Name.size() > 0;
     }
 
+    bool IsBitField() const
+    {
+      return BitWidth >= 0;
+    }
+
     bool operator==(const MemberRecord& rhs) const
     {
-      return Type == rhs.Type && Name == rhs.Name && ArgumentName == rhs.ArgumentName;
+      return Type == rhs.Type && Name == rhs.Name && ArgumentName == rhs.ArgumentName && OffsetInBits == rhs.OffsetInBits && BitWidth == rhs.BitWidth;
     }
 
     bool operator!=(const MemberRecord& rhs) const
@@ -0,0 +1,105 @@
+#ifndef MB_OUTPUTMANIFEST_HPP
+#define MB_OUTPUTMANIFEST_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace MB
+{
+  struct OutputManifestEntry
+  {
+    //! The hash of the content we last wrote (or verified) to the file
+    uint64_t ContentHash;
+    //! The size of the file on disk
+    uint64_t Size;
+    //! The platform specific last write time of the file on disk
+    uint64_t LastWriteTime;
+    //! True if the file was written or verified during this run
+    bool Touched;
+
+    OutputManifestEntry()
+      : ContentHash(0)
+      , Size(0)
+      , LastWriteTime(0)
+      , Touched(false)
+    {
+    }
+
+    OutputManifestEntry(const uint64_t contentHash, const uint64_t size, const uint64_t lastWriteTime)
+      : ContentHash(contentHash)
+      , Size(size)
+      , LastWriteTime(lastWriteTime)
+      , Touched(true)
+    {
+    }
+  };
+
+
+  //! @brief Records the content hash, size and last write time of every file that is generated below a root directory.
+  //!        If the size and last write time on disk still match the recorded values the file is known to contain the recorded content,
+  //!        so a unchanged file can be skipped by comparing hashes instead of reading it back.
+  //! @note  This is thread safe.
+  class OutputManifest
+  {
+    Fsl::IO::Path m_rootPath;
+    Fsl::IO::Path m_manifestPath;
+    std::string m_rootPrefix;
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, OutputManifestEntry> m_entries;
+    bool m_isDirty;
+
+  public:
+    OutputManifest(const OutputManifest&) = delete;
+    OutputManifest& operator=(const OutputManifest&) = delete;
+
+    //! @brief Load the manifest stored in the root path (if it exist and is valid)
+    explicit OutputManifest(const Fsl::IO::Path& rootPath);
+
+    const Fsl::IO::Path& GetRootPath() const
+    {
+      return m_rootPath;
+    }
+
+    //! @brief Check if the file is located below the root path
+    bool Contains(const Fsl::IO::Path& fileName) const;
+
+    //! @brief Write the content to the file unless its known to contain it already.
+    //! @return true if the file was written
+    //! @throws std::invalid_argument if the file isn't located below the root path
+    bool WriteAllTextIfChanged(const Fsl::IO::Path& fileName, const std::string& content);
+
+    //! @brief Save the manifest if anything changed, only the files that were touched during this run are stored.
+    void Save();
+
+    //! @brief Get the name of the manifest file stored in the root path
+    static const char* GetFileName();
+
+  private:
+    std::string GetRelativePath(const Fsl::IO::Path& fileName) const;
+  };
+}
+#endif
@@ -0,0 +1,121 @@
+#ifndef MB_PARALLELUTIL_HPP
+#define MB_PARALLELUTIL_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/JobConsole.hpp>
+#include <RAIIGen/Profiler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace MB
+{
+  namespace ParallelUtil
+  {
+    //! @brief Resolve the number of threads to use for the given amount of work.
+    //! @param requestedWorkerCount the requested number of workers (0 = use the hardware concurrency).
+    //! @param workItemCount the number of work items, we never spawn more workers than there is work.
+    inline std::size_t GetWorkerCount(const uint32_t requestedWorkerCount, const std::size_t workItemCount)
+    {
+      std::size_t workerCount = requestedWorkerCount;
+      if (workerCount == 0)
+        workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+      return std::max(std::min(workerCount, workItemCount), std::size_t(1));
+    }
+
+
+    //! @brief Call func(index) for every index in [0, count[ using up to requestedWorkerCount threads (the calling thread is one of them).
+    //! @note  Work items are handed out one at a time, so the order they complete in is undefined.
+    //!        If a work item throws the remaining unstarted items are skipped and the first exception is rethrown once all workers have stopped.
+    //!        The workers print to the job console buffer of the calling thread (if any) and record their profile events under its job.
+    //!        The allocations made by the workers are credited to the calling thread, so a enclosing ProfileScope includes them.
+    template <typename TFunc>
+    void ForEachIndex(const std::size_t count, const uint32_t requestedWorkerCount, TFunc func)
+    {
+      const auto workerCount = GetWorkerCount(requestedWorkerCount, count);
+      if (workerCount <= 1)
+      {
+        for (std::size_t i = 0; i < count; ++i)
+          func(i);
+        return;
+      }
+
+      std::atomic<std::size_t> nextIndex(0);
+      std::atomic<bool> abort(false);
+      std::mutex errorLock;
+      std::exception_ptr firstError;
+
+      auto worker = [&]() {
+        while (!abort)
+        {
+          const std::size_t index = nextIndex++;
+          if (index >= count)
+            return;
+          try
+          {
+            func(index);
+          }
+          catch (...)
+          {
+            std::lock_guard<std::mutex> lock(errorLock);
+            if (!firstError)
+              firstError = std::current_exception();
+            abort = true;
+          }
+        }
+      };
+
+      JobConsoleBuffer* const pConsoleBuffer = JobConsole::GetThreadBuffer();
+      const std::string profileJob(Profiler::GetThreadJob());
+      std::atomic<uint64_t> workerAllocationCount(0);
+      std::atomic<uint64_t> workerAllocatedBytes(0);
+      std::vector<std::thread> threads;
+      threads.reserve(workerCount - 1);
+      for (std::size_t i = 1; i < workerCount; ++i)
+      {
+        threads.emplace_back([&worker, &profileJob, &workerAllocationCount, &workerAllocatedBytes, pConsoleBuffer]() {
+          JobConsole::SetThreadBuffer(pConsoleBuffer);
+          Profiler::SetThreadJob(profileJob);
+          const auto startAllocationCount = Profiler::GetThreadAllocationCount();
+          const auto startAllocatedBytes = Profiler::GetThreadAllocatedBytes();
+          worker();
+          workerAllocationCount += Profiler::GetThreadAllocationCount() - startAllocationCount;
+          workerAllocatedBytes += Profiler::GetThreadAllocatedBytes() - startAllocatedBytes;
+        });
+      }
+      worker();
+      for (auto& rThread : threads)
+        rThread.join();
+      Profiler::AddThreadAllocations(workerAllocationCount, workerAllocatedBytes);
+
+      if (firstError)
+        std::rethrow_exception(firstError);
+    }
+  }
+}
+#endif
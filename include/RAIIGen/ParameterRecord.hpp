@@ -23,6 +23,7 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/ParameterType.hpp>
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/TypeRecord.hpp>
 #include <string>
 
@@ -31,8 +32,8 @@ namespace MB
   struct ParameterRecord
   {
     TypeRecord Type;
-    std::string Name;
-    std::string ArgumentName;
+    Symbol Name;
+    Symbol ArgumentName;
     bool IsAutoGeneratedName;
     bool IsAutoGeneratedArgumentName;
     ParameterType ParamType;
@@ -0,0 +1,121 @@
+#ifndef MB_PATTERNTRIE_HPP
+#define MB_PATTERNTRIE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace MB
+{
+  //! @brief A trie of string patterns where each node knows the ids of the patterns that end at it.
+  //!        Walking a string from the root visits every pattern that is a prefix of it, so matching a string against all patterns costs
+  //!        at most one step per character no matter how many patterns there are. Adding the patterns reversed and walking the string
+  //!        backwards turns it into a postfix matcher.
+  class PatternTrie
+  {
+    struct Node
+    {
+      //! The children sorted by character (the alphabet of a identifier is small so a sorted array beats a map)
+      std::vector<std::pair<char, uint32_t>> Children;
+      std::vector<uint32_t> PatternIds;
+    };
+
+    std::vector<Node> m_nodes;
+
+  public:
+    PatternTrie()
+      : m_nodes(1)
+    {
+    }
+
+    bool IsEmpty() const
+    {
+      return m_nodes.size() == 1 && m_nodes[0].PatternIds.empty();
+    }
+
+    //! @brief Add the pattern given by the character range
+    template <typename TIterator>
+    void Add(TIterator begin, const TIterator end, const uint32_t patternId)
+    {
+      uint32_t nodeIndex = 0;
+      for (; begin != end; ++begin)
+        nodeIndex = GetOrAddChild(nodeIndex, *begin);
+      m_nodes[nodeIndex].PatternIds.push_back(patternId);
+    }
+
+    //! @brief Walk the character range and call the predicate for each pattern that is a prefix of the range (shortest patterns first).
+    //! @return true as soon as the predicate returns true, false if it never did
+    template <typename TIterator, typename TPredicate>
+    bool AnyPrefixOf(TIterator begin, const TIterator end, TPredicate predicate) const
+    {
+      uint32_t nodeIndex = 0;
+      while (true)
+      {
+        for (const auto patternId : m_nodes[nodeIndex].PatternIds)
+        {
+          if (predicate(patternId))
+            return true;
+        }
+        if (begin == end)
+          return false;
+        nodeIndex = FindChild(nodeIndex, *begin);
+        if (nodeIndex == 0)
+          return false;
+        ++begin;
+      }
+    }
+
+  private:
+    //! @return the child index or zero if there is no such child (the root is never a child)
+    uint32_t FindChild(const uint32_t nodeIndex, const char ch) const
+    {
+      const auto& children = m_nodes[nodeIndex].Children;
+      for (const auto& child : children)
+      {
+        if (child.first == ch)
+          return child.second;
+        if (child.first > ch)
+          break;
+      }
+      return 0;
+    }
+
+    uint32_t GetOrAddChild(const uint32_t nodeIndex, const char ch)
+    {
+      auto& rChildren = m_nodes[nodeIndex].Children;
+      auto itr = rChildren.begin();
+      while (itr != rChildren.end() && itr->first < ch)
+        ++itr;
+      if (itr != rChildren.end() && itr->first == ch)
+        return itr->second;
+
+      const auto childIndex = static_cast<uint32_t>(m_nodes.size());
+      // Insert the edge before the node array grows, since growing it invalidates rChildren
+      rChildren.insert(itr, std::make_pair(ch, childIndex));
+      m_nodes.emplace_back();
+      return childIndex;
+    }
+  };
+}
+#endif
@@ -0,0 +1,172 @@
+#ifndef MB_PROFILER_HPP
+#define MB_PROFILER_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace MB
+{
+  //! @brief The totals of all the events recorded for a phase
+  struct ProfilePhaseTotal
+  {
+    uint64_t Count;
+    //! The sum of the event durations in microseconds, events on different threads can overlap so this can exceed the wall time
+    uint64_t Duration;
+    uint64_t AllocationCount;
+    uint64_t AllocatedBytes;
+
+    ProfilePhaseTotal()
+      : Count(0)
+      , Duration(0)
+      , AllocationCount(0)
+      , AllocatedBytes(0)
+    {
+    }
+  };
+
+  //! The phase totals keyed on (job, phase)
+  using ProfilePhaseTotals = std::map<std::pair<std::string, std::string>, ProfilePhaseTotal>;
+
+
+  //! @brief Collects timed events for the phases of the pipeline so they can be written as a Chrome trace (chrome://tracing).
+  //!        Nothing is recorded unless the profiler has been enabled.
+  //! @note  This is thread safe.
+  class Profiler
+  {
+  public:
+    static void Enable();
+    static bool IsEnabled();
+
+    //! @brief Get the current time in microseconds
+    static uint64_t GetTime();
+
+    //! @brief Record a completed event for the calling thread
+    static void AddEvent(const char* const pszName, const uint64_t startTime, const uint64_t duration, const uint64_t allocationCount,
+                         const uint64_t allocatedBytes);
+
+    //! @brief Record the current peak resident set size as a counter event
+    static void AddMemorySample();
+
+    //! @brief Get the name of the job the calling thread is working on
+    static const std::string& GetThreadJob();
+    static void SetThreadJob(const std::string& name);
+
+    //! @brief The number of allocations made by the process since the profiler was enabled
+    //! @note  The global allocation functions are replaced by the profiler, but they only update the counters once it is enabled.
+    static uint64_t GetAllocationCount();
+    //! @brief The number of bytes allocated by the process since the profiler was enabled
+    static uint64_t GetAllocatedBytes();
+    //! @brief The number of allocations made by the calling thread (and the workers it has joined) since the profiler was enabled
+    static uint64_t GetThreadAllocationCount();
+    //! @brief The number of bytes allocated by the calling thread (and the workers it has joined) since the profiler was enabled
+    static uint64_t GetThreadAllocatedBytes();
+    //! @brief Credit the allocations made by a worker thread to the calling thread once it has joined the worker
+    static void AddThreadAllocations(const uint64_t allocationCount, const uint64_t allocatedBytes);
+    //! @brief The current resident set size of the process in bytes (0 if unavailable)
+    static uint64_t GetResidentSetSize();
+    //! @brief The peak resident set size over the lifetime of the process in bytes (0 if unavailable)
+    static uint64_t GetPeakResidentSetSize();
+
+    //! @brief Discard all the recorded events
+    static void Clear();
+
+    //! @brief Get the totals of the recorded events
+    static ProfilePhaseTotals GetPhaseTotals();
+
+    //! @brief Write all the recorded events as a Chrome trace JSON file, the phase totals are included as well.
+    static void WriteChromeTrace(const Fsl::IO::Path& path);
+
+    //! @brief Write the total time spent in each phase for each job
+    static void WriteSummary(std::ostream& rStream);
+  };
+
+
+  //! @brief Records a event covering the lifetime of the object
+  //! @note  Only the allocations made by the calling thread and the ParallelUtil workers it joins are counted. This keeps the totals of
+  //!        concurrent jobs from including each other's allocations.
+  class ProfileScope
+  {
+    const char* m_pszName;
+    bool m_isEnabled;
+    uint64_t m_startTime;
+    uint64_t m_startAllocationCount;
+    uint64_t m_startAllocatedBytes;
+
+  public:
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    explicit ProfileScope(const char* const pszName)
+      : m_pszName(pszName)
+      , m_isEnabled(Profiler::IsEnabled())
+      , m_startTime(0)
+      , m_startAllocationCount(0)
+      , m_startAllocatedBytes(0)
+    {
+      if (m_isEnabled)
+      {
+        m_startAllocationCount = Profiler::GetThreadAllocationCount();
+        m_startAllocatedBytes = Profiler::GetThreadAllocatedBytes();
+        m_startTime = Profiler::GetTime();
+      }
+    }
+
+    ~ProfileScope()
+    {
+      if (m_isEnabled)
+      {
+        const auto endTime = Profiler::GetTime();
+        Profiler::AddEvent(m_pszName, m_startTime, endTime - m_startTime, Profiler::GetThreadAllocationCount() - m_startAllocationCount,
+                           Profiler::GetThreadAllocatedBytes() - m_startAllocatedBytes);
+      }
+    }
+  };
+
+
+  //! @brief Tag the events recorded by the calling thread with the job name for the lifetime of the object
+  class ScopedProfileJob
+  {
+    std::string m_previousJob;
+
+  public:
+    ScopedProfileJob(const ScopedProfileJob&) = delete;
+    ScopedProfileJob& operator=(const ScopedProfileJob&) = delete;
+
+    explicit ScopedProfileJob(const std::string& name)
+      : m_previousJob(Profiler::GetThreadJob())
+    {
+      Profiler::SetThreadJob(name);
+    }
+
+    ~ScopedProfileJob()
+    {
+      Profiler::SetThreadJob(m_previousJob);
+    }
+  };
+}
+#endif
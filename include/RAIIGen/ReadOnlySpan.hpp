@@ -0,0 +1,106 @@
+#ifndef MB_READONLYSPAN_HPP
+#define MB_READONLYSPAN_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace MB
+{
+  //! @brief A non owning read only view of a contiguous array.
+  //!        The span is only valid as long as the array it was created from is alive and unmodified.
+  template <typename T>
+  class ReadOnlySpan
+  {
+    const T* m_pData;
+    std::size_t m_length;
+
+  public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    ReadOnlySpan()
+      : m_pData(nullptr)
+      , m_length(0)
+    {
+    }
+
+    ReadOnlySpan(const T* const pData, const std::size_t length)
+      : m_pData(pData)
+      , m_length(length)
+    {
+      assert(pData != nullptr || length == 0);
+    }
+
+    ReadOnlySpan(const std::vector<T>& values)
+      : m_pData(values.data())
+      , m_length(values.size())
+    {
+    }
+
+    const T* data() const
+    {
+      return m_pData;
+    }
+
+    std::size_t size() const
+    {
+      return m_length;
+    }
+
+    bool empty() const
+    {
+      return m_length == 0;
+    }
+
+    const T* begin() const
+    {
+      return m_pData;
+    }
+
+    const T* end() const
+    {
+      return m_pData + m_length;
+    }
+
+    const T& operator[](const std::size_t index) const
+    {
+      assert(index < m_length);
+      return m_pData[index];
+    }
+
+    const T& front() const
+    {
+      assert(m_length > 0);
+      return m_pData[0];
+    }
+
+    const T& back() const
+    {
+      assert(m_length > 0);
+      return m_pData[m_length - 1];
+    }
+  };
+}
+#endif
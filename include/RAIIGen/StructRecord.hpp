@@ -22,24 +22,32 @@
 //* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //***************************************************************************************************************************************************
 
+#include <RAIIGen/Symbol.hpp>
 #include <RAIIGen/TypeRecord.hpp>
 #include <RAIIGen/MemberRecord.hpp>
 #include <RAIIGen/VersionRecord.hpp>
-#include <deque>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace MB
 {
   struct StructRecord
   {
-    std::string Name;
-    std::deque<MemberRecord> Members;
+    Symbol Name;
+    std::vector<MemberRecord> Members;
     VersionRecord Version;
+    //! The size of the struct in bytes (negative if the struct has no known layout)
+    int64_t SizeOf;
+    //! The alignment of the struct in bytes (negative if the struct has no known layout)
+    int64_t AlignOf;
 
     StructRecord()
       : Name()
       , Members()
       , Version()
+      , SizeOf(-1)
+      , AlignOf(-1)
     {
     }
 
@@ -47,20 +55,24 @@ namespace MB
       : Name(name)
       , Members()
       , Version()
+      , SizeOf(-1)
+      , AlignOf(-1)
     {
     }
 
     void Clear()
     {
-      Name.clear();
+      Name = Symbol();
       Members.clear();
       Version.Clear();
+      SizeOf = -1;
+      AlignOf = -1;
     }
 
 
     bool operator==(const StructRecord& rhs) const
     {
-      return Name == rhs.Name && Members == rhs.Members && Version == rhs.Version;
+      return Name == rhs.Name && Members == rhs.Members && Version == rhs.Version && SizeOf == rhs.SizeOf && AlignOf == rhs.AlignOf;
     }
 
     bool operator!=(const StructRecord& rhs) const
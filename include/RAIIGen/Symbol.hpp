@@ -0,0 +1,192 @@
+#ifndef MB_SYMBOL_HPP
+#define MB_SYMBOL_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace MB
+{
+  //! @brief A interned immutable string.
+  //!        All symbols with the same content share the same storage, so copying a symbol is a pointer copy and comparing two symbols is a
+  //!        pointer compare. The storage is owned by a process wide symbol table and is never released, which is fine for a code generator.
+  //! @note  Creating a symbol from a string is thread safe. The constructors are explicit since they intern the string, use TryFind to look up a
+  //!        symbol without adding it to the table.
+  class Symbol
+  {
+    const std::string* m_pValue;
+
+  public:
+    //! @brief Create a empty symbol
+    Symbol();
+    explicit Symbol(const std::string& value);
+    explicit Symbol(const char* const psz);
+
+    //! @brief Find the symbol for the string without interning it
+    //! @return false if the string has never been interned (so no symbol with that content exists)
+    static bool TryFind(Symbol& rSymbol, const std::string& value);
+
+    const std::string& Get() const
+    {
+      return *m_pValue;
+    }
+
+    operator const std::string&() const
+    {
+      return *m_pValue;
+    }
+
+    const char* c_str() const
+    {
+      return m_pValue->c_str();
+    }
+
+    std::size_t size() const
+    {
+      return m_pValue->size();
+    }
+
+    bool empty() const
+    {
+      return m_pValue->empty();
+    }
+
+    std::size_t find(const std::string& value, const std::size_t pos = 0) const
+    {
+      return m_pValue->find(value, pos);
+    }
+
+    std::size_t find(const char ch, const std::size_t pos = 0) const
+    {
+      return m_pValue->find(ch, pos);
+    }
+
+    std::string substr(const std::size_t pos = 0, const std::size_t count = std::string::npos) const
+    {
+      return m_pValue->substr(pos, count);
+    }
+
+    //! @brief A unique id for the content of the symbol (only valid for the lifetime of the process)
+    std::size_t GetId() const
+    {
+      return reinterpret_cast<std::size_t>(m_pValue);
+    }
+
+    bool operator==(const Symbol& rhs) const
+    {
+      return m_pValue == rhs.m_pValue;
+    }
+
+    bool operator!=(const Symbol& rhs) const
+    {
+      return m_pValue != rhs.m_pValue;
+    }
+
+    //! @brief Symbols are ordered by their content so the order is stable between runs
+    bool operator<(const Symbol& rhs) const
+    {
+      return m_pValue != rhs.m_pValue && *m_pValue < *rhs.m_pValue;
+    }
+  };
+
+
+  inline bool operator==(const Symbol& lhs, const std::string& rhs)
+  {
+    return lhs.Get() == rhs;
+  }
+
+  inline bool operator==(const std::string& lhs, const Symbol& rhs)
+  {
+    return lhs == rhs.Get();
+  }
+
+  inline bool operator==(const Symbol& lhs, const char* const rhs)
+  {
+    return lhs.Get() == rhs;
+  }
+
+  inline bool operator!=(const Symbol& lhs, const std::string& rhs)
+  {
+    return lhs.Get() != rhs;
+  }
+
+  inline bool operator!=(const std::string& lhs, const Symbol& rhs)
+  {
+    return lhs != rhs.Get();
+  }
+
+  inline bool operator!=(const Symbol& lhs, const char* const rhs)
+  {
+    return lhs.Get() != rhs;
+  }
+
+  inline std::string operator+(const Symbol& lhs, const Symbol& rhs)
+  {
+    return lhs.Get() + rhs.Get();
+  }
+
+  inline std::string operator+(const Symbol& lhs, const std::string& rhs)
+  {
+    return lhs.Get() + rhs;
+  }
+
+  inline std::string operator+(const std::string& lhs, const Symbol& rhs)
+  {
+    return lhs + rhs.Get();
+  }
+
+  inline std::string operator+(const Symbol& lhs, const char* const rhs)
+  {
+    return lhs.Get() + rhs;
+  }
+
+  inline std::string operator+(const char* const lhs, const Symbol& rhs)
+  {
+    return lhs + rhs.Get();
+  }
+
+  inline std::string& operator+=(std::string& rLhs, const Symbol& rhs)
+  {
+    return rLhs += rhs.Get();
+  }
+
+  inline std::ostream& operator<<(std::ostream& rStream, const Symbol& symbol)
+  {
+    return rStream << symbol.Get();
+  }
+}
+
+namespace std
+{
+  template <>
+  struct hash<MB::Symbol>
+  {
+    std::size_t operator()(const MB::Symbol& symbol) const
+    {
+      return std::hash<std::size_t>()(symbol.GetId());
+    }
+  };
+}
+#endif
@@ -0,0 +1,136 @@
+#ifndef MB_SYMBOLINDEX_HPP
+#define MB_SYMBOLINDEX_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Symbol.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace MB
+{
+  //! @brief A open addressing (linear probing) hash index that maps a Symbol to a array index.
+  //!        Since symbols are interned a lookup only compares symbol ids and never the string content.
+  class SymbolIndex
+  {
+    struct Entry
+    {
+      //! The symbol id, zero marks a unused slot (a interned symbol never has a zero id)
+      std::size_t Id;
+      uint32_t Index;
+
+      Entry()
+        : Id(0)
+        , Index(0)
+      {
+      }
+    };
+
+    std::vector<Entry> m_entries;
+    std::size_t m_count;
+
+  public:
+    static const uint32_t InvalidIndex = 0xFFFFFFFF;
+
+    SymbolIndex()
+      : m_count(0)
+    {
+    }
+
+    void Clear()
+    {
+      m_entries.clear();
+      m_count = 0;
+    }
+
+    std::size_t Size() const
+    {
+      return m_count;
+    }
+
+    //! @brief Add the symbol, if the symbol is already present the existing index is kept.
+    //! @return true if the symbol was added
+    bool TryAdd(const Symbol& symbol, const uint32_t index)
+    {
+      // Keep the load factor at or below 0.5 so the probe sequences stay short
+      if ((m_count + 1) * 2 > m_entries.size())
+        Grow();
+
+      const auto id = symbol.GetId();
+      auto slot = GetSlot(id);
+      while (m_entries[slot].Id != 0)
+      {
+        if (m_entries[slot].Id == id)
+          return false;
+        slot = (slot + 1) & (m_entries.size() - 1);
+      }
+      m_entries[slot].Id = id;
+      m_entries[slot].Index = index;
+      ++m_count;
+      return true;
+    }
+
+    //! @brief Find the index associated with the symbol
+    //! @return the index or InvalidIndex if the symbol is unknown
+    uint32_t Find(const Symbol& symbol) const
+    {
+      if (m_entries.empty())
+        return InvalidIndex;
+
+      const auto id = symbol.GetId();
+      auto slot = GetSlot(id);
+      while (m_entries[slot].Id != 0)
+      {
+        if (m_entries[slot].Id == id)
+          return m_entries[slot].Index;
+        slot = (slot + 1) & (m_entries.size() - 1);
+      }
+      return InvalidIndex;
+    }
+
+  private:
+    std::size_t GetSlot(const std::size_t id) const
+    {
+      // The ids are addresses so the low bits carry little information, mix them before masking
+      const auto hash = static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL;
+      return static_cast<std::size_t>(hash >> 32) & (m_entries.size() - 1);
+    }
+
+    void Grow()
+    {
+      std::vector<Entry> oldEntries;
+      oldEntries.swap(m_entries);
+      m_entries.resize(oldEntries.empty() ? 16 : oldEntries.size() * 2);
+      for (const auto& entry : oldEntries)
+      {
+        if (entry.Id != 0)
+        {
+          auto slot = GetSlot(entry.Id);
+          while (m_entries[slot].Id != 0)
+            slot = (slot + 1) & (m_entries.size() - 1);
+          m_entries[slot] = entry;
+        }
+      }
+    }
+  };
+}
+#endif
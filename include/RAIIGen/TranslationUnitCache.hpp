@@ -0,0 +1,60 @@
+#ifndef MB_TRANSLATIONUNITCACHE_HPP
+#define MB_TRANSLATIONUNITCACHE_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <FslBase/IO/Path.hpp>
+#include <clang-c/Index.h>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace MB
+{
+  //! @brief A persistent on disk cache of parsed translation units saved with clang_saveTranslationUnit.
+  //!        Each entry is keyed by a hash of the file name, the clang arguments, the parse flags and the clang version.
+  //!        Next to the saved translation unit a list of every file it included and their content hash is stored, so a change to any
+  //!        of them triggers a reparse. Loading a saved translation unit is a lot cheaper than parsing the header again.
+  //! @note  It is safe to use the cache from multiple threads.
+  class TranslationUnitCache
+  {
+    Fsl::IO::Path m_cachePath;
+
+  public:
+    //! @param cachePath the directory the cache entries are stored in (its created on demand)
+    explicit TranslationUnitCache(const Fsl::IO::Path& cachePath);
+
+    //! @brief Calculate the key of the translation unit produced by parsing the file with the given arguments and flags
+    static uint64_t CalculateKey(const Fsl::IO::Path& filename, const std::deque<std::string>& clangArgs, const unsigned parseFlags);
+
+    //! @brief Load the translation unit stored under the key
+    //! @return the translation unit or nullptr if no up to date entry exist
+    CXTranslationUnit TryLoad(CXIndex index, const uint64_t key) const;
+
+    //! @brief Store the translation unit under the key, failing to store it is reported as a warning.
+    //! @note  The translation unit must have been parsed with CXTranslationUnit_ForSerialization
+    void Store(CXTranslationUnit translationUnit, const uint64_t key, const std::vector<Fsl::IO::Path>& includedFiles) const;
+  };
+}
+
+#endif
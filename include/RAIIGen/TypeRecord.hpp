@@ -22,19 +22,29 @@
 //* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //***************************************************************************************************************************************************
 
+#include <RAIIGen/Symbol.hpp>
+#include <cstdint>
 #include <string>
 
 namespace MB
 {
   struct TypeRecord
   {
-    std::string FullTypeString;
-    std::string Name;
+    Symbol FullTypeString;
+    Symbol Name;
     bool IsConstQualified;
     bool IsPointer;
     // bool IsPointerPointer;
     bool IsStruct;
     bool IsFunctionPointer;
+    //! The size of the type in bytes (negative if the type has no known layout)
+    int64_t SizeOf;
+    //! The alignment of the type in bytes (negative if the type has no known layout)
+    int64_t AlignOf;
+    //! The size in bytes of the type a pointer points to (negative if the type is not a pointer or the pointee has no known layout)
+    int64_t PointeeSizeOf;
+    //! True if the type a pointer points to is trivially copyable (POD)
+    bool IsPointeeTriviallyCopyable;
 
     TypeRecord()
       : FullTypeString()
@@ -44,6 +54,10 @@ namespace MB
       //, IsPointerPointer(false)
       , IsStruct(false)
       , IsFunctionPointer(false)
+      , SizeOf(-1)
+      , AlignOf(-1)
+      , PointeeSizeOf(-1)
+      , IsPointeeTriviallyCopyable(false)
     {
     }
 
@@ -57,7 +71,8 @@ namespace MB
     bool operator==(const TypeRecord& rhs) const
     {
       return FullTypeString == rhs.FullTypeString && Name == rhs.Name && IsConstQualified == rhs.IsConstQualified && IsPointer == rhs.IsPointer &&
-             IsStruct == rhs.IsStruct && IsFunctionPointer == rhs.IsFunctionPointer;
+             IsStruct == rhs.IsStruct && IsFunctionPointer == rhs.IsFunctionPointer && SizeOf == rhs.SizeOf && AlignOf == rhs.AlignOf &&
+             PointeeSizeOf == rhs.PointeeSizeOf && IsPointeeTriviallyCopyable == rhs.IsPointeeTriviallyCopyable;
     }
 
     bool operator!=(const TypeRecord& rhs) const
@@ -0,0 +1,85 @@
+#ifndef MB_VERSIONINDEX_HPP
+#define MB_VERSIONINDEX_HPP
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/VersionRecord.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace MB
+{
+  struct HistoryDelta;
+
+  //! @brief Maps the name of every struct, function, enum and enum member to the version it first appeared in.
+  //!        The index is built in one forward pass over the history, so each lookup is a single hash lookup.
+  class VersionIndex
+  {
+    std::unordered_map<std::string, VersionRecord> m_structs;
+    std::unordered_map<std::string, VersionRecord> m_functions;
+    std::unordered_map<std::string, VersionRecord> m_enums;
+    std::unordered_map<std::string, std::unordered_map<std::string, VersionRecord>> m_enumMembers;
+
+  public:
+    VersionIndex();
+
+    //! @brief Add the symbols that were introduced by the delta, this must be called in version order (oldest first) as existing entries are
+    //!        never overwritten.
+    void Add(const HistoryDelta& delta);
+
+    //! @brief Register the first appearance of the given symbol (ignored if the symbol is already known)
+    void AddStruct(const std::string& name, const VersionRecord& version);
+    void AddFunction(const std::string& name, const VersionRecord& version);
+    void AddEnum(const std::string& name, const VersionRecord& version);
+    void AddEnumMember(const std::string& enumName, const std::string& enumMemberName, const VersionRecord& version);
+
+    const std::unordered_map<std::string, VersionRecord>& GetStructs() const
+    {
+      return m_structs;
+    }
+
+    const std::unordered_map<std::string, VersionRecord>& GetFunctions() const
+    {
+      return m_functions;
+    }
+
+    const std::unordered_map<std::string, VersionRecord>& GetEnums() const
+    {
+      return m_enums;
+    }
+
+    const std::unordered_map<std::string, std::unordered_map<std::string, VersionRecord>>& GetEnumMembers() const
+    {
+      return m_enumMembers;
+    }
+
+    //! @brief Get the version the struct first appeared in (throws a NotFoundException if its not part of the history)
+    const VersionRecord& GetStructVersion(const std::string& name) const;
+    //! @brief Get the version the function first appeared in (throws a NotFoundException if its not part of the history)
+    const VersionRecord& GetFunctionVersion(const std::string& name) const;
+    //! @brief Get the version the enum first appeared in (throws a NotFoundException if its not part of the history)
+    const VersionRecord& GetEnumVersion(const std::string& name) const;
+    //! @brief Get the version the enum member first appeared in (throws a NotFoundException if its not part of the history)
+    const VersionRecord& GetEnumMemberVersion(const std::string& enumName, const std::string& enumMemberName) const;
+  };
+}
+#endif
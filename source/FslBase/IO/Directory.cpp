@@ -85,6 +85,12 @@ namespace Fsl
     }
 
 
+    bool Directory::TryDelete(const Path& path)
+    {
+      return PlatformFileSystem::TryDeleteDir(path);
+    }
+
+
     Path Directory::GetCurrentWorkingDirectory()
     {
       return Path(Platform::GetCurrentWorkingDirectory());
@@ -196,6 +196,24 @@ namespace Fsl
     }
 
 
+    bool File::TryGetStatus(const Path& path, uint64_t& rSize, uint64_t& rLastWriteTime)
+    {
+      return PlatformFileSystem::TryGetFileStatus(path, rSize, rLastWriteTime);
+    }
+
+
+    void File::Move(const Path& sourceFileName, const Path& destFileName)
+    {
+      PlatformFileSystem::Move(sourceFileName, destFileName);
+    }
+
+
+    bool File::TryDelete(const Path& path)
+    {
+      return PlatformFileSystem::TryDelete(path);
+    }
+
+
     uint64_t File::GetLength(const Path& path)
     {
       std::ifstream file(PATH_GET_NAME(path), std::ios::ate | std::ios::binary);
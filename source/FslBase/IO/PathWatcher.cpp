@@ -50,7 +50,8 @@ namespace Fsl
       std::shared_ptr<PlatformPathMonitorToken> Token;
 
       PathWatcherInternalRecord(const Path& fullPath, std::shared_ptr<PlatformPathMonitorToken> token)
-        : Token(std::move(token))
+        : FullPath(fullPath)
+        , Token(std::move(token))
       {
       }
 
@@ -136,5 +137,19 @@ namespace Fsl
       }
       return false;
     }
+
+
+    bool PathWatcher::Check(std::deque<IO::Path>& rChangedPaths)
+    {
+      rChangedPaths.clear();
+      for (auto itr = m_paths.begin(); itr != m_paths.end(); ++itr)
+      {
+        if ((*itr)->CheckForChanges())
+        {
+          rChangedPaths.push_back((*itr)->FullPath);
+        }
+      }
+      return !rChangedPaths.empty();
+    }
   }
 }
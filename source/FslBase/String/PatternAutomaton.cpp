@@ -0,0 +1,142 @@
+/****************************************************************************************************************************************************
+ * Copyright (c) 2014 Freescale Semiconductor, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the Freescale Semiconductor, Inc. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/String/PatternAutomaton.hpp>
+#include <algorithm>
+#include <iterator>
+
+namespace Fsl
+{
+  const int32_t PatternAutomaton::RootState;
+
+
+  PatternAutomaton::PatternAutomaton()
+    : m_nodes(1)
+    , m_patternCount(0)
+  {
+    // The root loops back to itself for every character
+    std::fill(std::begin(m_nodes[RootState].Next), std::end(m_nodes[RootState].Next), RootState);
+    m_nodes[RootState].Match = -1;
+  }
+
+
+  PatternAutomaton::PatternAutomaton(const std::vector<std::string>& patterns)
+    : m_nodes(1)
+    , m_patternCount(patterns.size())
+  {
+    std::fill(std::begin(m_nodes[RootState].Next), std::end(m_nodes[RootState].Next), -1);
+    m_nodes[RootState].Match = -1;
+
+    // Build the trie
+    for (std::size_t patternIndex = 0; patternIndex < patterns.size(); ++patternIndex)
+    {
+      int32_t nodeIndex = RootState;
+      for (const char ch : patterns[patternIndex])
+      {
+        const auto chIndex = static_cast<uint8_t>(ch);
+        if (m_nodes[nodeIndex].Next[chIndex] < 0)
+        {
+          Node node;
+          std::fill(std::begin(node.Next), std::end(node.Next), -1);
+          node.Match = -1;
+          m_nodes[nodeIndex].Next[chIndex] = static_cast<int32_t>(m_nodes.size());
+          m_nodes.push_back(node);
+        }
+        nodeIndex = m_nodes[nodeIndex].Next[chIndex];
+      }
+      if (m_nodes[nodeIndex].Match < 0)
+      {
+        m_nodes[nodeIndex].Match = static_cast<int32_t>(patternIndex);
+      }
+    }
+
+    // Resolve the failure links breadth first and turn the trie into a complete automaton
+    std::vector<int32_t> failure(m_nodes.size(), RootState);
+    std::vector<int32_t> queue;
+    queue.reserve(m_nodes.size());
+    for (auto& rNext : m_nodes[RootState].Next)
+    {
+      if (rNext < 0)
+      {
+        rNext = RootState;
+      }
+      else
+      {
+        queue.push_back(rNext);
+      }
+    }
+
+    for (std::size_t queueIndex = 0; queueIndex < queue.size(); ++queueIndex)
+    {
+      const int32_t nodeIndex = queue[queueIndex];
+      // Inherit the longest match ending here from the failure node (it is always shorter than a match of the node itself)
+      if (m_nodes[nodeIndex].Match < 0)
+      {
+        m_nodes[nodeIndex].Match = m_nodes[failure[nodeIndex]].Match;
+      }
+
+      for (std::size_t chIndex = 0; chIndex < 256; ++chIndex)
+      {
+        const int32_t child = m_nodes[nodeIndex].Next[chIndex];
+        if (child < 0)
+        {
+          m_nodes[nodeIndex].Next[chIndex] = m_nodes[failure[nodeIndex]].Next[chIndex];
+        }
+        else
+        {
+          failure[child] = m_nodes[failure[nodeIndex]].Next[chIndex];
+          queue.push_back(child);
+        }
+      }
+    }
+  }
+
+
+  bool PatternAutomaton::IsFoundIn(const std::string& str) const
+  {
+    // A empty pattern is contained in every string
+    if (m_nodes[RootState].Match >= 0)
+    {
+      return true;
+    }
+
+    int32_t state = RootState;
+    for (const char ch : str)
+    {
+      state = Next(state, ch);
+      if (m_nodes[state].Match >= 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+}
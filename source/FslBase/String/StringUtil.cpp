@@ -35,9 +35,79 @@
 #include <iterator>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 
 namespace Fsl
 {
+  namespace
+  {
+    std::vector<std::string> GetReversedPatterns(const std::vector<std::pair<std::string, std::string>>& replacements)
+    {
+      std::vector<std::string> patterns;
+      patterns.reserve(replacements.size());
+      for (const auto& replacement : replacements)
+      {
+        if (replacement.first.empty())
+        {
+          throw std::invalid_argument("A replacement pattern can not be empty");
+        }
+        patterns.emplace_back(replacement.first.rbegin(), replacement.first.rend());
+      }
+      return patterns;
+    }
+  }
+
+
+  StringReplacer::StringReplacer(const std::vector<std::pair<std::string, std::string>>& replacements)
+    : m_reversedPatterns(GetReversedPatterns(replacements))
+    , m_replacements(replacements)
+  {
+  }
+
+
+  std::string StringReplacer::Replace(const std::string& src) const
+  {
+    const std::size_t length = src.size();
+
+    // Scan the input backwards with the automaton of the reversed patterns. The longest reversed pattern that ends at a position is the
+    // longest pattern that starts there, so one pass finds the best match for every start position.
+    std::vector<int32_t> longestMatch(length);
+    bool hasMatch = false;
+    int32_t state = PatternAutomaton::RootState;
+    for (std::size_t index = length; index > 0; --index)
+    {
+      state = m_reversedPatterns.Next(state, src[index - 1]);
+      longestMatch[index - 1] = m_reversedPatterns.GetMatch(state);
+      hasMatch = hasMatch || longestMatch[index - 1] >= 0;
+    }
+    if (!hasMatch)
+    {
+      return src;
+    }
+
+    // Then take the leftmost match and skip past it, so every character is visited once in each direction
+    std::string result;
+    result.reserve(length);
+    std::size_t copyFrom = 0;
+    std::size_t index = 0;
+    while (index < length)
+    {
+      const int32_t match = longestMatch[index];
+      if (match < 0)
+      {
+        ++index;
+        continue;
+      }
+      result.append(src, copyFrom, index - copyFrom);
+      result += m_replacements[match].second;
+      index += m_replacements[match].first.size();
+      copyFrom = index;
+    }
+    result.append(src, copyFrom, std::string::npos);
+    return result;
+  }
+
+
   namespace StringUtil
   {
     bool Contains(const std::string& src, const char ch)
@@ -116,16 +186,37 @@ namespace Fsl
         return;
       }
 
-      for (std::size_t pos = 0;; pos += newValue.length())
+      std::size_t pos = rStr.find(oldValue);
+      if (pos == std::string::npos)
       {
-        pos = rStr.find(oldValue, pos);
-        if (pos == std::string::npos)
-        {
-          break;
-        }
-        rStr.erase(pos, oldValue.length());
-        rStr.insert(pos, newValue);
+        return;
+      }
+
+      // Build the result in a new buffer so each match costs O(length) instead of moving the remainder of the string
+      std::string result;
+      result.reserve(rStr.size());
+      std::size_t copyFrom = 0;
+      while (pos != std::string::npos)
+      {
+        result.append(rStr, copyFrom, pos - copyFrom);
+        result += newValue;
+        copyFrom = pos + oldValue.size();
+        pos = rStr.find(oldValue, copyFrom);
+      }
+      result.append(rStr, copyFrom, std::string::npos);
+      rStr.swap(result);
+    }
+
+
+    void ReplaceAll(std::string& rStr, const std::vector<std::pair<std::string, std::string>>& replacements)
+    {
+      if (replacements.empty())
+      {
+        return;
       }
+      const StringReplacer replacer(replacements);
+      std::string result = replacer.Replace(rStr);
+      rStr.swap(result);
     }
 
     // std::string Replace(const std::string& str, const std::string& oldValue, const std::string& newValue)
@@ -38,6 +38,8 @@
 #include <cstring>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <cstdio>
+#include <unistd.h>
 
 namespace Fsl
 {
@@ -138,6 +140,39 @@ namespace Fsl
     }
 
 
+    bool PlatformFileSystem::TryGetFileStatus(const Path& path, uint64_t& rSize, uint64_t& rLastWriteTime)
+    {
+      struct stat s;
+      if (stat(path.ToUTF8String().c_str(), &s) != 0 || !S_ISREG(s.st_mode))
+        return false;
+
+      rSize = static_cast<uint64_t>(s.st_size);
+      rLastWriteTime = static_cast<uint64_t>(s.st_mtime);
+      return true;
+    }
+
+
+    void PlatformFileSystem::Move(const Path& sourceFileName, const Path& destFileName)
+    {
+      if (rename(sourceFileName.ToUTF8String().c_str(), destFileName.ToUTF8String().c_str()) != 0)
+      {
+        throw IOException("Failed to move file");
+      }
+    }
+
+
+    bool PlatformFileSystem::TryDelete(const Path& path)
+    {
+      return unlink(path.ToUTF8String().c_str()) == 0;
+    }
+
+
+    bool PlatformFileSystem::TryDeleteDir(const Path& path)
+    {
+      return rmdir(path.ToUTF8String().c_str()) == 0;
+    }
+
+
     std::shared_ptr<PlatformPathMonitorToken> PlatformFileSystem::CreatePathMonitorToken(const Path& fullPath)
     {
       if (!Path::IsPathRooted(fullPath))
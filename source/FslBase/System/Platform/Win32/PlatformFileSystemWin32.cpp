@@ -170,6 +170,43 @@ namespace Fsl
     }
 
 
+    bool PlatformFileSystem::TryGetFileStatus(const Path& path, uint64_t& rSize, uint64_t& rLastWriteTime)
+    {
+      WIN32_FILE_ATTRIBUTE_DATA attributeData;
+      if (GetFileAttributesEx(PlatformWin32::Widen(path.ToUTF8String()).c_str(), GetFileExInfoStandard, &attributeData) == 0 ||
+          (attributeData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY)
+      {
+        return false;
+      }
+
+      rSize = (static_cast<uint64_t>(attributeData.nFileSizeHigh) << 32) | attributeData.nFileSizeLow;
+      rLastWriteTime = (static_cast<uint64_t>(attributeData.ftLastWriteTime.dwHighDateTime) << 32) | attributeData.ftLastWriteTime.dwLowDateTime;
+      return true;
+    }
+
+
+    void PlatformFileSystem::Move(const Path& sourceFileName, const Path& destFileName)
+    {
+      if (MoveFileEx(PlatformWin32::Widen(sourceFileName.ToUTF8String()).c_str(), PlatformWin32::Widen(destFileName.ToUTF8String()).c_str(),
+                     MOVEFILE_REPLACE_EXISTING) == 0)
+      {
+        throw IOException("Failed to move file");
+      }
+    }
+
+
+    bool PlatformFileSystem::TryDelete(const Path& path)
+    {
+      return DeleteFile(PlatformWin32::Widen(path.ToUTF8String()).c_str()) != 0;
+    }
+
+
+    bool PlatformFileSystem::TryDeleteDir(const Path& path)
+    {
+      return RemoveDirectory(PlatformWin32::Widen(path.ToUTF8String()).c_str()) != 0;
+    }
+
+
     std::shared_ptr<PlatformPathMonitorToken> PlatformFileSystem::CreatePathMonitorToken(const Path& fullPath)
     {
       if (!Path::IsPathRooted(fullPath))
@@ -0,0 +1,185 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/AsyncFileWriter.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/Profiler.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    //! Writing is mostly waiting on the disk so a few threads is enough
+    const uint32_t DEFAULT_WORKER_COUNT = 2;
+  }
+
+
+  AsyncFileWriter::AsyncFileWriter(const uint32_t workerCount)
+    : m_activeJobs(0)
+    , m_quit(false)
+  {
+    const uint32_t finalWorkerCount = std::max(workerCount != 0 ? workerCount : DEFAULT_WORKER_COUNT, 1u);
+    m_threads.reserve(finalWorkerCount);
+    for (uint32_t i = 0; i < finalWorkerCount; ++i)
+      m_threads.emplace_back(&AsyncFileWriter::WorkerMain, this);
+  }
+
+
+  AsyncFileWriter::~AsyncFileWriter()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_idle.wait(lock, [this]() { return m_jobs.empty() && m_activeJobs == 0; });
+      m_quit = true;
+    }
+    m_jobAvailable.notify_all();
+    for (auto& rThread : m_threads)
+      rThread.join();
+
+    for (const auto& error : m_errors)
+      std::cout << "ERROR: " << error.second << "\n";
+  }
+
+
+  void AsyncFileWriter::Enqueue(const IO::Path& fileName, std::string&& content, const OutputManifest* const pManifest)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_jobs.emplace_back(fileName, std::move(content), Profiler::GetThreadJob(), pManifest);
+      ++m_pendingWrites[pManifest];
+    }
+    m_jobAvailable.notify_one();
+  }
+
+
+  void AsyncFileWriter::Join()
+  {
+    std::vector<std::string> errors;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_idle.wait(lock, [this]() { return m_jobs.empty() && m_activeJobs == 0; });
+      for (auto& rError : m_errors)
+        errors.push_back(std::move(rError.second));
+      m_errors.clear();
+    }
+    ThrowOnErrors(errors);
+  }
+
+
+  void AsyncFileWriter::Join(const OutputManifest* const pManifest)
+  {
+    std::vector<std::string> errors;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_idle.wait(lock, [this, pManifest]() { return m_pendingWrites.find(pManifest) == m_pendingWrites.end(); });
+      // Only the errors of the manifest are reported, the other ones belong to whoever joins their manifest
+      auto itrFirstOther = std::stable_partition(m_errors.begin(), m_errors.end(), [pManifest](const std::pair<const OutputManifest*, std::string>& entry) {
+        return entry.first == pManifest;
+      });
+      for (auto itr = m_errors.begin(); itr != itrFirstOther; ++itr)
+        errors.push_back(std::move(itr->second));
+      m_errors.erase(m_errors.begin(), itrFirstOther);
+    }
+    ThrowOnErrors(errors);
+  }
+
+
+  void AsyncFileWriter::ThrowOnErrors(const std::vector<std::string>& errors)
+  {
+    if (errors.empty())
+      return;
+
+    std::string message = fmt::format("Failed to write {} file(s):", errors.size());
+    for (const auto& error : errors)
+      message += "\n  " + error;
+    throw std::runtime_error(message);
+  }
+
+
+  void AsyncFileWriter::WorkerMain()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      m_jobAvailable.wait(lock, [this]() { return m_quit || !m_jobs.empty(); });
+      if (m_jobs.empty())
+        return;
+
+      WriteJob job(std::move(m_jobs.front()));
+      m_jobs.pop_front();
+      ++m_activeJobs;
+      lock.unlock();
+
+      std::string error;
+      try
+      {
+        ScopedProfileJob profileJob(job.ProfileJob);
+        ProfileScope profileScope("Write");
+        EnsureDirectory(job.FileName);
+        IOUtil::WriteAllTextIfChangedNow(job.FileName, job.Content);
+      }
+      catch (const std::exception& ex)
+      {
+        error = fmt::format("'{}': {}", job.FileName.ToUTF8String(), ex.what());
+      }
+
+      lock.lock();
+      if (!error.empty())
+        m_errors.emplace_back(job.pManifest, std::move(error));
+      --m_activeJobs;
+      auto itrPending = m_pendingWrites.find(job.pManifest);
+      const bool isManifestDone = (--itrPending->second) == 0;
+      if (isManifestDone)
+        m_pendingWrites.erase(itrPending);
+      if (isManifestDone || (m_jobs.empty() && m_activeJobs == 0))
+        m_idle.notify_all();
+    }
+  }
+
+
+  void AsyncFileWriter::EnsureDirectory(const IO::Path& fileName)
+  {
+    const auto directoryName = IO::Path::GetDirectoryName(fileName);
+    if (directoryName.IsEmpty())
+      return;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_createdDirectories.find(directoryName.ToUTF8String()) != m_createdDirectories.end())
+        return;
+    }
+
+    // Creating a directory that already exists is harmless, so two threads racing here is fine
+    IO::Directory::CreateDir(directoryName);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_createdDirectories.insert(directoryName.ToUTF8String());
+  }
+}
@@ -0,0 +1,164 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Benchmark/PipelineBenchmark.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <functional>
+
+namespace MB
+{
+  namespace
+  {
+    //! The profiler phases reported as stages, in pipeline order
+    const char* const g_stages[] = {"Parse",    "CursorVisit",            "HistoryIndex", "HistoryTagging", "FunctionMatching",
+                                    "Analysis", "ObjectFunctionMatching", "Render",       "Write",          "FlushWrites"};
+
+    struct Statistics
+    {
+      double Min;
+      double Median;
+      double Max;
+
+      Statistics()
+        : Min(0.0)
+        , Median(0.0)
+        , Max(0.0)
+      {
+      }
+    };
+
+
+    Statistics CalculateStatistics(std::vector<double> values)
+    {
+      Statistics result;
+      if (values.empty())
+        return result;
+      std::sort(values.begin(), values.end());
+      result.Min = values.front();
+      result.Max = values.back();
+      const std::size_t middle = values.size() / 2;
+      result.Median = (values.size() % 2) != 0 ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+      return result;
+    }
+
+
+    std::vector<double> Collect(const std::vector<PipelineBenchmarkSample>& samples,
+                                const std::function<double(const PipelineBenchmarkSample&)>& func)
+    {
+      std::vector<double> values;
+      values.reserve(samples.size());
+      for (const auto& sample : samples)
+        values.push_back(func(sample));
+      return values;
+    }
+
+
+    //! The events of a run are tagged with different jobs (the capture and the generation run under different names), so the stage is summed
+    //! across all of them
+    ProfilePhaseTotal GetStageTotal(const ProfilePhaseTotals& totals, const std::string& stage)
+    {
+      ProfilePhaseTotal result;
+      for (const auto& entry : totals)
+      {
+        if (entry.first.second == stage)
+        {
+          result.Count += entry.second.Count;
+          result.Duration += entry.second.Duration;
+          result.AllocationCount += entry.second.AllocationCount;
+          result.AllocatedBytes += entry.second.AllocatedBytes;
+        }
+      }
+      return result;
+    }
+
+
+    double ToMegaBytes(const double bytes)
+    {
+      return bytes / (1024.0 * 1024.0);
+    }
+
+
+    void ReportRow(std::ostream& rStream, const std::string& name, const Statistics& timeMs, const double symbolCount, const std::string& extra)
+    {
+      const double symbolsPerSecond = timeMs.Median > 0.0 ? symbolCount / (timeMs.Median / 1000.0) : 0.0;
+      rStream << fmt::format("  {:<24} {:>10.2f} {:>10.2f} {:>10.2f} {:>14.0f}  {}\n", name, timeMs.Min, timeMs.Median, timeMs.Max, symbolsPerSecond,
+                             extra);
+    }
+  }
+
+
+  void PipelineBenchmark::AddSample(const std::string& jobName, const PipelineBenchmarkSample& sample)
+  {
+    auto itrFind = m_samples.find(jobName);
+    if (itrFind == m_samples.end())
+    {
+      m_jobNames.push_back(jobName);
+      itrFind = m_samples.emplace(jobName, std::vector<PipelineBenchmarkSample>()).first;
+    }
+    itrFind->second.push_back(sample);
+  }
+
+
+  void PipelineBenchmark::Report(std::ostream& rStream) const
+  {
+    for (const auto& jobName : m_jobNames)
+    {
+      const auto& samples = m_samples.find(jobName)->second;
+      const double symbolCount = samples.empty() ? 0.0 : static_cast<double>(samples.front().SymbolCount);
+
+      rStream << fmt::format("{}: {} run(s), {} symbols\n", jobName, samples.size(), samples.front().SymbolCount);
+      rStream << fmt::format("  {:<24} {:>10} {:>10} {:>10} {:>14}  {}\n", "Stage", "Min ms", "Median ms", "Max ms", "Symbols/s",
+                             "Median allocations");
+
+      const auto captureWall =
+        CalculateStatistics(Collect(samples, [](const PipelineBenchmarkSample& sample) { return sample.CaptureWallTime / 1000.0; }));
+      const auto captureRss = CalculateStatistics(
+        Collect(samples, [](const PipelineBenchmarkSample& sample) { return static_cast<double>(sample.ResidentSetSizeAfterCapture); }));
+      ReportRow(rStream, "Capture (wall)", captureWall, symbolCount, fmt::format("RSS after {:.1f}MB", ToMegaBytes(captureRss.Median)));
+
+      const auto generateWall =
+        CalculateStatistics(Collect(samples, [](const PipelineBenchmarkSample& sample) { return sample.GenerateWallTime / 1000.0; }));
+      const auto generateRss = CalculateStatistics(
+        Collect(samples, [](const PipelineBenchmarkSample& sample) { return static_cast<double>(sample.ResidentSetSizeAfterGenerate); }));
+      const auto processPeakRss = CalculateStatistics(
+        Collect(samples, [](const PipelineBenchmarkSample& sample) { return static_cast<double>(sample.ProcessPeakResidentSetSize); }));
+      ReportRow(rStream, "Generate (wall)", generateWall, symbolCount,
+                fmt::format("RSS after {:.1f}MB, process peak {:.1f}MB", ToMegaBytes(generateRss.Median), ToMegaBytes(processPeakRss.Max)));
+
+      for (const auto* pszStage : g_stages)
+      {
+        const std::string stage(pszStage);
+        const auto durations = Collect(
+          samples, [&stage](const PipelineBenchmarkSample& sample) { return GetStageTotal(sample.PhaseTotals, stage).Duration / 1000.0; });
+        const auto allocations = Collect(samples, [&stage](const PipelineBenchmarkSample& sample) {
+          return static_cast<double>(GetStageTotal(sample.PhaseTotals, stage).AllocationCount);
+        });
+        const auto timeMs = CalculateStatistics(durations);
+        if (timeMs.Max > 0.0)
+          ReportRow(rStream, stage, timeMs, symbolCount, fmt::format("{:.0f}", CalculateStatistics(allocations).Median));
+      }
+    }
+    rStream << "The stage times are summed across threads so they can exceed the wall time.\n"
+            << "The RSS after a stage is the median current process RSS, the process peak covers the whole process lifetime so far.\n";
+  }
+}
@@ -0,0 +1,191 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Benchmark/StringBenchmark.hpp>
+#include <FslBase/String/StringUtil.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const int BENCHMARK_ITERATIONS = 7;
+
+    typedef std::vector<std::pair<std::string, std::string>> ReplacementList;
+
+    //! The original StringUtil::Replace implementation that erases and inserts at every match
+    void LegacyReplace(std::string& rStr, const std::string& oldValue, const std::string& newValue)
+    {
+      if (oldValue.empty())
+        return;
+
+      for (std::size_t pos = 0;; pos += newValue.length())
+      {
+        pos = rStr.find(oldValue, pos);
+        if (pos == std::string::npos)
+          break;
+        rStr.erase(pos, oldValue.length());
+        rStr.insert(pos, newValue);
+      }
+    }
+
+
+    //! @brief Run the function a number of times and return the fastest run in microseconds
+    double Measure(const std::function<std::string()>& func, std::string& rResult)
+    {
+      double bestTime = 0.0;
+      for (int i = 0; i < BENCHMARK_ITERATIONS; ++i)
+      {
+        const auto start = std::chrono::steady_clock::now();
+        rResult = func();
+        const auto end = std::chrono::steady_clock::now();
+        const double time = std::chrono::duration<double, std::micro>(end - start).count();
+        bestTime = (i == 0 ? time : std::min(bestTime, time));
+      }
+      return bestTime;
+    }
+
+
+    void Report(std::ostream& rStream, const std::string& name, const double baselineTime, const double time)
+    {
+      rStream << fmt::format("  {:<40} {:>12.1f} us {:>8.2f}x\n", name, time, time > 0.0 ? baselineTime / time : 0.0);
+    }
+
+
+    //! @brief A single pattern with many matches, this is where the erase/insert implementation turns quadratic
+    void BenchmarkSinglePattern(std::ostream& rStream, const std::size_t matchCount)
+    {
+      std::string source;
+      for (std::size_t i = 0; i < matchCount; ++i)
+        source += "static const int ##NAME##Value = 0;\n";
+
+      std::string resultLegacy;
+      std::string result;
+      const double legacyTime = Measure(
+        [&source]() {
+          std::string content(source);
+          LegacyReplace(content, "##NAME##", "MyLongerReplacementName");
+          return content;
+        },
+        resultLegacy);
+      const double time = Measure(
+        [&source]() {
+          std::string content(source);
+          StringUtil::Replace(content, "##NAME##", "MyLongerReplacementName");
+          return content;
+        },
+        result);
+      if (result != resultLegacy)
+        throw std::runtime_error("StringUtil::Replace produced a different result than the legacy implementation");
+
+      rStream << fmt::format("Single pattern, {} matches ({} bytes)\n", matchCount, source.size());
+      Report(rStream, "legacy Replace", legacyTime, legacyTime);
+      Report(rStream, "StringUtil::Replace", legacyTime, time);
+    }
+
+
+    //! @brief A template like input where a set of placeholders are substituted (like the copy file pass)
+    void BenchmarkMultiPattern(std::ostream& rStream, const std::size_t blockCount)
+    {
+      const ReplacementList replacements = {{"##API_NAME##", "Vulkan"},
+                                            {"##API_VERSION##", "1.0"},
+                                            {"##PROGRAM_NAME##", "RAIIGen"},
+                                            {"##PROGRAM_VERSION##", "V0.5.2"},
+                                            {"##NAMESPACE_NAME##", "RapidVulkan"},
+                                            {"##NAMESPACE_NAME!##", "RAPIDVULKAN"},
+                                            {"##CLASS_NAME##", "CommandBuffer"},
+                                            {"##CLASS_NAME!##", "COMMANDBUFFER"},
+                                            {"##RESOURCE_TYPE##", "VkCommandBuffer"},
+                                            {"##RESOURCE_MEMBER_NAME##", "m_commandBuffer"},
+                                            {"##AG_TOOL_STATEMENT##", "Auto-generated Vulkan 1.0 C++11 RAII classes by RAIIGen"}};
+
+      std::string source;
+      for (std::size_t i = 0; i < blockCount; ++i)
+      {
+        source += "// ##AG_TOOL_STATEMENT## (##PROGRAM_NAME## ##PROGRAM_VERSION##)\n";
+        source += "namespace ##NAMESPACE_NAME##\n{\n  //! ##API_NAME## ##API_VERSION## ##NAMESPACE_NAME!##_##CLASS_NAME!##\n";
+        source += "  ##CLASS_NAME##::##CLASS_NAME##(const ##RESOURCE_TYPE## value)\n    : ##RESOURCE_MEMBER_NAME##(value)\n  {\n  }\n}\n";
+      }
+
+      std::string resultLegacy;
+      std::string resultReplace;
+      std::string resultReplaceAll;
+      std::string resultReplacer;
+      const double legacyTime = Measure(
+        [&source, &replacements]() {
+          std::string content(source);
+          for (const auto& entry : replacements)
+            LegacyReplace(content, entry.first, entry.second);
+          return content;
+        },
+        resultLegacy);
+      const double replaceTime = Measure(
+        [&source, &replacements]() {
+          std::string content(source);
+          for (const auto& entry : replacements)
+            StringUtil::Replace(content, entry.first, entry.second);
+          return content;
+        },
+        resultReplace);
+      const double replaceAllTime = Measure(
+        [&source, &replacements]() {
+          std::string content(source);
+          StringUtil::ReplaceAll(content, replacements);
+          return content;
+        },
+        resultReplaceAll);
+      const StringReplacer replacer(replacements);
+      const double replacerTime = Measure([&source, &replacer]() { return replacer.Replace(source); }, resultReplacer);
+
+      if (resultReplace != resultLegacy || resultReplaceAll != resultLegacy || resultReplacer != resultLegacy)
+        throw std::runtime_error("The multi pattern replace produced a different result than the legacy implementation");
+
+      rStream << fmt::format("{} patterns, {} blocks ({} bytes)\n", replacements.size(), blockCount, source.size());
+      Report(rStream, "legacy Replace per pattern", legacyTime, legacyTime);
+      Report(rStream, "StringUtil::Replace per pattern", legacyTime, replaceTime);
+      Report(rStream, "StringUtil::ReplaceAll", legacyTime, replaceAllTime);
+      Report(rStream, "StringReplacer (prebuilt)", legacyTime, replacerTime);
+    }
+  }
+
+
+  namespace StringBenchmark
+  {
+    void Run(std::ostream& rStream)
+    {
+      rStream << fmt::format("String replace benchmarks (best of {} runs)\n", BENCHMARK_ITERATIONS);
+      BenchmarkSinglePattern(rStream, 100);
+      BenchmarkSinglePattern(rStream, 10000);
+      BenchmarkMultiPattern(rStream, 10);
+      BenchmarkMultiPattern(rStream, 1000);
+    }
+  }
+}
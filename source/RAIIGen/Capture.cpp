@@ -35,6 +35,7 @@
 #include <RAIIGen/Capture.hpp>
 #include <RAIIGen/CaseUtil.hpp>
 #include <RAIIGen/ClangUtil.hpp>
+#include <RAIIGen/Profiler.hpp>
 #include <RAIIGen/StringHelper.hpp>
 
 using namespace Fsl;
@@ -208,11 +209,14 @@ namespace MB
     TypeRecord GetType(const CXType type, const std::shared_ptr<CustomLog>& pLog)
     {
       TypeRecord typeRecord;
-      typeRecord.FullTypeString = GetTypeSpelling(type);
+      typeRecord.FullTypeString = Symbol(GetTypeSpelling(type));
 
       const auto typeInfo = GetTypeInfo(type, pLog);
-      typeRecord.Name = typeInfo.Name;
+      typeRecord.Name = Symbol(typeInfo.Name);
       typeRecord.IsConstQualified = clang_isConstQualifiedType(typeInfo.Type) != 0;
+      // libclang reports a unknown layout as a negative CXTypeLayoutError
+      typeRecord.SizeOf = clang_Type_getSizeOf(type);
+      typeRecord.AlignOf = clang_Type_getAlignOf(type);
 
       const auto canonicalType = clang_getCanonicalType(typeInfo.Type);
       if (canonicalType.kind == CXType_Record)
@@ -232,6 +236,8 @@ namespace MB
       {
         typeRecord.IsPointer = true;
         auto pointerType = clang_getPointeeType(type);
+        typeRecord.PointeeSizeOf = clang_Type_getSizeOf(pointerType);
+        typeRecord.IsPointeeTriviallyCopyable = clang_isPODType(pointerType) != 0;
         // if (pointerType.kind == CXType_Pointer)
         //  typeRecord.IsPointerPointer = true;
       }
@@ -281,18 +287,18 @@ namespace MB
                                  const std::shared_ptr<CustomLog>& pLog)
     {
       ParameterRecord param;
-      param.Name = StringHelper::EnforceLowerCamelCaseNameStyle(GetCursorSpelling(cursor));
+      param.Name = Symbol(StringHelper::EnforceLowerCamelCaseNameStyle(GetCursorSpelling(cursor)));
       param.Type = GetType(cursor, pLog);
-      param.ArgumentName = StringHelper::EnforceLowerCamelCaseNameStyle(GetCursorDisplayName(cursor));
+      param.ArgumentName = Symbol(StringHelper::EnforceLowerCamelCaseNameStyle(GetCursorDisplayName(cursor)));
 
       if (param.Name.size() <= 0)
       {
-        param.Name = TypeToArgumentName(param.Type, typeNamePrefix);
+        param.Name = Symbol(TypeToArgumentName(param.Type, typeNamePrefix));
         param.IsAutoGeneratedName = true;
       }
       if (param.ArgumentName.size() <= 0)
       {
-        param.ArgumentName = TypeToArgumentName(param.Type, typeNamePrefix);
+        param.ArgumentName = Symbol(TypeToArgumentName(param.Type, typeNamePrefix));
         param.IsAutoGeneratedArgumentName = true;
       }
 
@@ -313,8 +319,8 @@ namespace MB
                                                   rParam.ArgumentName + "' does not match the expected '" + itr->ParameterOldName + "' name"));
           }
 
-          rParam.Name = itr->ParameterNewName;
-          rParam.ArgumentName = itr->ParameterNewName;
+          rParam.Name = Symbol(itr->ParameterNewName);
+          rParam.ArgumentName = Symbol(itr->ParameterNewName);
         }
       }
     }
@@ -332,7 +338,7 @@ namespace MB
                                                   "' does not match the expected '" + itr->ParameterOldType + "' name"));
           }
 
-          rParam.Type.FullTypeString = itr->ParameterNewType;
+          rParam.Type.FullTypeString = Symbol(itr->ParameterNewType);
         }
       }
     }
@@ -343,7 +349,7 @@ namespace MB
     {
       FunctionRecord currentFunction;
 
-      currentFunction.Name = GetCursorSpelling(cursor);
+      currentFunction.Name = Symbol(GetCursorSpelling(cursor));
 
       // Extract return type
       {
@@ -353,8 +359,9 @@ namespace MB
 
       // Extract parameters
       {
-        std::unordered_set<std::string> uniqueArgumentNames;
+        std::unordered_set<Symbol> uniqueArgumentNames;
         const unsigned int numArgs = clang_Cursor_getNumArguments(cursor);
+        currentFunction.Parameters.reserve(numArgs);
         for (unsigned int i = 0; i < numArgs; ++i)
         {
           const CXCursor argCursor = clang_Cursor_getArgument(cursor, i);
@@ -371,7 +378,7 @@ namespace MB
           {
             rFuncErrors.DuplicatedParameterNames.push_back(DuplicatedParameterName(param.Name, i));
           }
-          currentFunction.Parameters.push_back(param);
+          currentFunction.Parameters.push_back(std::move(param));
         }
       }
       if (rFuncErrors.DuplicatedParameterNames.size() > 0)
@@ -380,10 +387,18 @@ namespace MB
     }
 
 
-    bool MatchesFilter(const std::deque<std::string>& filters, const std::string& functionName)
+    PatternTrie BuildFilterTrie(const std::deque<std::string>& filters)
     {
-      return std::find_if(filters.begin(), filters.end(), [functionName](const std::string& val) { return functionName.find(val) == 0; }) !=
-             filters.end();
+      PatternTrie trie;
+      for (std::size_t i = 0; i < filters.size(); ++i)
+        trie.Add(filters[i].begin(), filters[i].end(), static_cast<uint32_t>(i));
+      return trie;
+    }
+
+
+    bool MatchesFilter(const PatternTrie& filters, const std::string& functionName)
+    {
+      return filters.AnyPrefixOf(functionName.begin(), functionName.end(), [](const uint32_t) { return true; });
     }
 
 
@@ -391,7 +406,11 @@ namespace MB
     {
       auto fieldType = GetType(cursor, pLog);
       const auto cursorSpelling = GetCursorSpelling(cursor);
-      return MemberRecord(fieldType, cursorSpelling);
+      MemberRecord member(fieldType, cursorSpelling);
+      member.OffsetInBits = clang_Cursor_getOffsetOfField(cursor);
+      if (clang_Cursor_isBitField(cursor) != 0)
+        member.BitWidth = clang_getFieldDeclBitWidth(cursor);
+      return member;
     }
 
 
@@ -421,12 +440,17 @@ namespace MB
 
   Capture::Capture(const CaptureConfig& config, CXCursor rootCursor, const std::shared_ptr<CustomLog>& log)
     : m_config(config)
+    , m_filters(BuildFilterTrie(config.Filters))
     , m_level(0)
     , m_records()
     , m_log(log)
   {
-    // WARNING: This should be called once the object is fully constructed
-    clang_visitChildren(rootCursor, Capture::VistorForwarder, this);
+    {
+      ProfileScope profileScope("CursorVisit");
+      // WARNING: This should be called once the object is fully constructed
+      clang_visitChildren(rootCursor, Capture::VistorForwarder, this);
+      BuildIndices();
+    }
 
     if (m_functionErrors.size() <= 0)
       return;
@@ -443,6 +467,19 @@ namespace MB
   }
 
 
+  Capture::Capture(const CaptureConfig& config, std::vector<FunctionRecord>&& functions, std::vector<StructRecord>&& structsInCapturedOrder,
+                   std::unordered_map<std::string, StructRecord>&& structs, std::unordered_map<std::string, EnumRecord>&& enums)
+    : m_config(config)
+    , m_level(0)
+    , m_records(std::move(functions))
+    , m_structsInCapturedOrder(std::move(structsInCapturedOrder))
+    , m_structs(std::move(structs))
+    , m_enums(std::move(enums))
+  {
+    BuildIndices();
+  }
+
+
   Capture::~Capture()
   {
   }
@@ -487,7 +524,7 @@ namespace MB
     {
       const auto functionName = GetCursorSpelling(cursor);
 
-      if (m_config.Filters.size() == 0 || MatchesFilter(m_config.Filters, functionName))
+      if (m_config.Filters.size() == 0 || MatchesFilter(m_filters, functionName))
       {
         // Extract basic information
         FunctionErrors funcErrors;
@@ -502,6 +539,9 @@ namespace MB
       auto fullName = BuildFullName(m_captureStructs, name);
       m_captureInfo.push_back(CaptureInfo(CaptureMode::Struct, m_level));
       m_captureStructs.push_back(StructRecord(fullName));
+      const auto structType = clang_getCursorType(cursor);
+      m_captureStructs.back().SizeOf = clang_Type_getSizeOf(structType);
+      m_captureStructs.back().AlignOf = clang_Type_getAlignOf(structType);
     }
     else if (cursorKind == CXCursor_EnumDecl)
     {
@@ -524,16 +564,23 @@ namespace MB
         case CaptureMode::Struct:
         {
           assert(m_captureStructs.size() > 0);
-          auto itrFindName = m_structs.find(m_captureStructs.back().Name);
-          m_structs[m_captureStructs.back().Name] = m_captureStructs.back();
+          auto& rStruct = m_captureStructs.back();
+          auto itrFindName = m_structs.find(rStruct.Name);
           if (itrFindName == m_structs.end())
-            m_structsInCapturedOrder.push_back(m_captureStructs.back());
+          {
+            m_structs[rStruct.Name] = rStruct;
+            m_structsInCapturedOrder.push_back(std::move(rStruct));
+          }
+          else
+          {
+            itrFindName->second = std::move(rStruct);
+          }
           m_captureStructs.pop_back();
           break;
         }
         case CaptureMode::Enum:
           assert(m_captureEnums.size() > 0);
-          m_enums[m_captureEnums.back().Name] = m_captureEnums.back();
+          m_enums[m_captureEnums.back().Name] = std::move(m_captureEnums.back());
           m_captureEnums.pop_back();
           break;
         default:
@@ -568,6 +615,26 @@ namespace MB
   }
 
 
+  void Capture::BuildIndices()
+  {
+    // If a function is declared multiple times the first declaration wins
+    m_functionIndex.Clear();
+    for (std::size_t i = 0; i < m_records.size(); ++i)
+      m_functionIndex.TryAdd(m_records[i].Name, static_cast<uint32_t>(i));
+  }
+
+
+  std::vector<Symbol> Capture::GetSortedEnumNames() const
+  {
+    std::vector<Symbol> names;
+    names.reserve(m_enums.size());
+    for (const auto& entry : m_enums)
+      names.push_back(entry.second.Name);
+    std::sort(names.begin(), names.end());
+    return names;
+  }
+
+
   CXChildVisitResult Capture::VistorForwarder(CXCursor cursor, CXCursor parent, CXClientData clientData)
   {
     auto pCapture = static_cast<Capture*>(clientData);
@@ -0,0 +1,547 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/CaptureCache.hpp>
+#include <RAIIGen/CapturedData.hpp>
+#include <RAIIGen/ClangFileData.hpp>
+#include <RAIIGen/HashUtil.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    // "RGCC" in little endian
+    const uint32_t CACHE_MAGIC = 0x43434752;
+    //! Increase this whenever the binary layout or the capture logic changes
+    const uint32_t CACHE_FORMAT_VERSION = 4;
+
+    class BinaryWriter
+    {
+      std::vector<uint8_t> m_data;
+
+    public:
+      void WriteUInt8(const uint8_t value)
+      {
+        m_data.push_back(value);
+      }
+
+      void WriteUInt32(const uint32_t value)
+      {
+        for (std::size_t i = 0; i < 4; ++i)
+          m_data.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+      }
+
+      void WriteUInt64(const uint64_t value)
+      {
+        for (std::size_t i = 0; i < 8; ++i)
+          m_data.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+      }
+
+      void WriteBytes(const std::vector<uint8_t>& data)
+      {
+        m_data.insert(m_data.end(), data.begin(), data.end());
+      }
+
+      const std::vector<uint8_t>& GetData() const
+      {
+        return m_data;
+      }
+    };
+
+
+    class BinaryReader
+    {
+      const std::vector<uint8_t>& m_data;
+      std::size_t m_position;
+
+    public:
+      explicit BinaryReader(const std::vector<uint8_t>& data)
+        : m_data(data)
+        , m_position(0)
+      {
+      }
+
+      uint8_t ReadUInt8()
+      {
+        EnsureAvailable(1);
+        return m_data[m_position++];
+      }
+
+      uint32_t ReadUInt32()
+      {
+        EnsureAvailable(4);
+        uint32_t value = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+          value |= static_cast<uint32_t>(m_data[m_position++]) << (i * 8);
+        return value;
+      }
+
+      uint64_t ReadUInt64()
+      {
+        EnsureAvailable(8);
+        uint64_t value = 0;
+        for (std::size_t i = 0; i < 8; ++i)
+          value |= static_cast<uint64_t>(m_data[m_position++]) << (i * 8);
+        return value;
+      }
+
+      std::string ReadRawString(const std::size_t length)
+      {
+        EnsureAvailable(length);
+        std::string value(reinterpret_cast<const char*>(m_data.data() + m_position), length);
+        m_position += length;
+        return value;
+      }
+
+      bool IsAtEnd() const
+      {
+        return m_position == m_data.size();
+      }
+
+    private:
+      void EnsureAvailable(const std::size_t length) const
+      {
+        if (length > (m_data.size() - m_position))
+          throw std::runtime_error("The cache entry is truncated");
+      }
+    };
+
+
+    //! Records reference strings by their index into a table that is stored once at the start of the entry
+    class StringTableBuilder
+    {
+      std::unordered_map<std::string, uint32_t> m_lookup;
+      std::deque<std::string> m_entries;
+
+    public:
+      uint32_t Add(const std::string& value)
+      {
+        const auto itrFind = m_lookup.find(value);
+        if (itrFind != m_lookup.end())
+          return itrFind->second;
+
+        const auto index = static_cast<uint32_t>(m_entries.size());
+        m_lookup[value] = index;
+        m_entries.push_back(value);
+        return index;
+      }
+
+      void Write(BinaryWriter& rWriter) const
+      {
+        rWriter.WriteUInt32(static_cast<uint32_t>(m_entries.size()));
+        for (const auto& entry : m_entries)
+        {
+          rWriter.WriteUInt32(static_cast<uint32_t>(entry.size()));
+          for (const auto ch : entry)
+            rWriter.WriteUInt8(static_cast<uint8_t>(ch));
+        }
+      }
+    };
+
+
+    class StringTable
+    {
+      std::vector<std::string> m_entries;
+
+    public:
+      explicit StringTable(BinaryReader& rReader)
+      {
+        const auto count = rReader.ReadUInt32();
+        m_entries.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          const auto length = rReader.ReadUInt32();
+          m_entries.push_back(rReader.ReadRawString(length));
+        }
+      }
+
+      const std::string& Read(BinaryReader& rReader) const
+      {
+        const auto index = rReader.ReadUInt32();
+        if (index >= m_entries.size())
+          throw std::runtime_error("The cache entry contains a invalid string index");
+        return m_entries[index];
+      }
+    };
+
+
+    std::string GetClangVersion()
+    {
+      CXString version = clang_getClangVersion();
+      std::string result(clang_getCString(version));
+      clang_disposeString(version);
+      return result;
+    }
+
+
+    uint64_t CalculateKey(const IO::Path& filename, const std::vector<IO::Path>& includePaths, const CaptureConfig& captureConfig)
+    {
+      Fnv1aHasher hasher;
+      hasher.Add(static_cast<uint64_t>(CACHE_FORMAT_VERSION));
+      // A different libclang can produce a different capture from the same input
+      hasher.Add(GetClangVersion());
+      hasher.Add(HashUtil::HashFileContent(filename));
+
+      hasher.Add(static_cast<uint64_t>(includePaths.size()));
+      for (const auto& path : includePaths)
+        hasher.Add(path.ToUTF8String());
+
+      const auto clangArgs = ClangFileData::BuildArguments(includePaths, captureConfig.ParseConfig);
+      hasher.Add(static_cast<uint64_t>(clangArgs.size()));
+      for (const auto& arg : clangArgs)
+        hasher.Add(arg);
+
+      HashUtil::AddCaptureConfig(hasher, captureConfig);
+      return hasher.GetHash();
+    }
+
+
+    void WriteVersion(BinaryWriter& rWriter, const VersionRecord& version)
+    {
+      rWriter.WriteUInt32(version.Major);
+      rWriter.WriteUInt32(version.Minor);
+      rWriter.WriteUInt32(version.Build);
+      rWriter.WriteUInt32(version.Hotfix);
+    }
+
+
+    void WriteType(BinaryWriter& rWriter, StringTableBuilder& rStrings, const TypeRecord& type)
+    {
+      rWriter.WriteUInt32(rStrings.Add(type.FullTypeString));
+      rWriter.WriteUInt32(rStrings.Add(type.Name));
+      rWriter.WriteUInt8((type.IsConstQualified ? 0x01 : 0) | (type.IsPointer ? 0x02 : 0) | (type.IsStruct ? 0x04 : 0) |
+                         (type.IsFunctionPointer ? 0x08 : 0) | (type.IsPointeeTriviallyCopyable ? 0x10 : 0));
+      rWriter.WriteUInt64(static_cast<uint64_t>(type.SizeOf));
+      rWriter.WriteUInt64(static_cast<uint64_t>(type.AlignOf));
+      rWriter.WriteUInt64(static_cast<uint64_t>(type.PointeeSizeOf));
+    }
+
+
+    void WriteFunction(BinaryWriter& rWriter, StringTableBuilder& rStrings, const FunctionRecord& function)
+    {
+      WriteType(rWriter, rStrings, function.ReturnType);
+      rWriter.WriteUInt32(rStrings.Add(function.Name));
+      rWriter.WriteUInt32(static_cast<uint32_t>(function.Parameters.size()));
+      for (const auto& param : function.Parameters)
+      {
+        WriteType(rWriter, rStrings, param.Type);
+        rWriter.WriteUInt32(rStrings.Add(param.Name));
+        rWriter.WriteUInt32(rStrings.Add(param.ArgumentName));
+        rWriter.WriteUInt8((param.IsAutoGeneratedName ? 0x01 : 0) | (param.IsAutoGeneratedArgumentName ? 0x02 : 0));
+        rWriter.WriteUInt8(static_cast<uint8_t>(param.ParamType));
+      }
+      WriteVersion(rWriter, function.Version);
+    }
+
+
+    void WriteStruct(BinaryWriter& rWriter, StringTableBuilder& rStrings, const StructRecord& record)
+    {
+      rWriter.WriteUInt32(rStrings.Add(record.Name));
+      rWriter.WriteUInt32(static_cast<uint32_t>(record.Members.size()));
+      for (const auto& member : record.Members)
+      {
+        WriteType(rWriter, rStrings, member.Type);
+        rWriter.WriteUInt32(rStrings.Add(member.Name));
+        rWriter.WriteUInt32(rStrings.Add(member.ArgumentName));
+        rWriter.WriteUInt64(static_cast<uint64_t>(member.OffsetInBits));
+        rWriter.WriteUInt32(static_cast<uint32_t>(member.BitWidth));
+      }
+      WriteVersion(rWriter, record.Version);
+      rWriter.WriteUInt64(static_cast<uint64_t>(record.SizeOf));
+      rWriter.WriteUInt64(static_cast<uint64_t>(record.AlignOf));
+    }
+
+
+    void WriteEnum(BinaryWriter& rWriter, StringTableBuilder& rStrings, const EnumRecord& record)
+    {
+      rWriter.WriteUInt32(rStrings.Add(record.Name));
+      rWriter.WriteUInt32(static_cast<uint32_t>(record.Members.size()));
+      for (const auto& member : record.Members)
+      {
+        rWriter.WriteUInt32(rStrings.Add(member.Name));
+        rWriter.WriteUInt64(member.UnsignedValue);
+        WriteVersion(rWriter, member.Version);
+      }
+      WriteVersion(rWriter, record.Version);
+    }
+
+
+    VersionRecord ReadVersion(BinaryReader& rReader)
+    {
+      const auto major = rReader.ReadUInt32();
+      const auto minor = rReader.ReadUInt32();
+      const auto build = rReader.ReadUInt32();
+      const auto hotfix = rReader.ReadUInt32();
+      return VersionRecord(major, minor, build, hotfix);
+    }
+
+
+    TypeRecord ReadType(BinaryReader& rReader, const StringTable& strings)
+    {
+      TypeRecord type;
+      type.FullTypeString = Symbol(strings.Read(rReader));
+      type.Name = Symbol(strings.Read(rReader));
+      const auto flags = rReader.ReadUInt8();
+      type.IsConstQualified = (flags & 0x01) != 0;
+      type.IsPointer = (flags & 0x02) != 0;
+      type.IsStruct = (flags & 0x04) != 0;
+      type.IsFunctionPointer = (flags & 0x08) != 0;
+      type.IsPointeeTriviallyCopyable = (flags & 0x10) != 0;
+      type.SizeOf = static_cast<int64_t>(rReader.ReadUInt64());
+      type.AlignOf = static_cast<int64_t>(rReader.ReadUInt64());
+      type.PointeeSizeOf = static_cast<int64_t>(rReader.ReadUInt64());
+      return type;
+    }
+
+
+    FunctionRecord ReadFunction(BinaryReader& rReader, const StringTable& strings)
+    {
+      FunctionRecord function;
+      function.ReturnType = ReadType(rReader, strings);
+      function.Name = Symbol(strings.Read(rReader));
+      const auto count = rReader.ReadUInt32();
+      function.Parameters.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        ParameterRecord param;
+        param.Type = ReadType(rReader, strings);
+        param.Name = Symbol(strings.Read(rReader));
+        param.ArgumentName = Symbol(strings.Read(rReader));
+        const auto flags = rReader.ReadUInt8();
+        param.IsAutoGeneratedName = (flags & 0x01) != 0;
+        param.IsAutoGeneratedArgumentName = (flags & 0x02) != 0;
+        const auto paramType = rReader.ReadUInt8();
+        if (paramType > static_cast<uint8_t>(ParameterType::ErrorCode))
+          throw std::runtime_error("The cache entry contains a invalid parameter type");
+        param.ParamType = static_cast<ParameterType>(paramType);
+        function.Parameters.push_back(std::move(param));
+      }
+      function.Version = ReadVersion(rReader);
+      return function;
+    }
+
+
+    StructRecord ReadStruct(BinaryReader& rReader, const StringTable& strings)
+    {
+      StructRecord record(strings.Read(rReader));
+      const auto count = rReader.ReadUInt32();
+      record.Members.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        MemberRecord member;
+        member.Type = ReadType(rReader, strings);
+        member.Name = Symbol(strings.Read(rReader));
+        member.ArgumentName = Symbol(strings.Read(rReader));
+        member.OffsetInBits = static_cast<int64_t>(rReader.ReadUInt64());
+        member.BitWidth = static_cast<int32_t>(rReader.ReadUInt32());
+        record.Members.push_back(std::move(member));
+      }
+      record.Version = ReadVersion(rReader);
+      record.SizeOf = static_cast<int64_t>(rReader.ReadUInt64());
+      record.AlignOf = static_cast<int64_t>(rReader.ReadUInt64());
+      return record;
+    }
+
+
+    EnumRecord ReadEnum(BinaryReader& rReader, const StringTable& strings)
+    {
+      EnumRecord record(strings.Read(rReader));
+      const auto count = rReader.ReadUInt32();
+      record.Members.reserve(count);
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        EnumMemberRecord member;
+        member.Name = Symbol(strings.Read(rReader));
+        member.UnsignedValue = rReader.ReadUInt64();
+        member.Version = ReadVersion(rReader);
+        record.Members.push_back(std::move(member));
+      }
+      record.Version = ReadVersion(rReader);
+      return record;
+    }
+
+
+    //! Entry layout: header (magic, format version, key), string table, dependencies, functions, structs in captured order, struct dict, enum dict.
+    std::vector<uint8_t> Serialize(const uint64_t key, const std::vector<IO::Path>& dependencies, const Capture& capture)
+    {
+      StringTableBuilder strings;
+      BinaryWriter body;
+
+      body.WriteUInt32(static_cast<uint32_t>(dependencies.size()));
+      for (const auto& dependency : dependencies)
+      {
+        body.WriteUInt32(strings.Add(dependency.ToUTF8String()));
+        body.WriteUInt64(HashUtil::HashFileContent(dependency));
+      }
+
+      const auto functions = capture.GetFunctions();
+      body.WriteUInt32(static_cast<uint32_t>(functions.size()));
+      for (const auto& function : functions)
+        WriteFunction(body, strings, function);
+
+      const auto structs = capture.GetStructs();
+      body.WriteUInt32(static_cast<uint32_t>(structs.size()));
+      for (const auto& record : structs)
+        WriteStruct(body, strings, record);
+
+      const auto& structDict = capture.GetStructDict();
+      body.WriteUInt32(static_cast<uint32_t>(structDict.size()));
+      for (const auto& entry : structDict)
+      {
+        body.WriteUInt32(strings.Add(entry.first));
+        WriteStruct(body, strings, entry.second);
+      }
+
+      const auto& enumDict = capture.GetEnumDict();
+      body.WriteUInt32(static_cast<uint32_t>(enumDict.size()));
+      for (const auto& entry : enumDict)
+      {
+        body.WriteUInt32(strings.Add(entry.first));
+        WriteEnum(body, strings, entry.second);
+      }
+
+      BinaryWriter writer;
+      writer.WriteUInt32(CACHE_MAGIC);
+      writer.WriteUInt32(CACHE_FORMAT_VERSION);
+      writer.WriteUInt64(key);
+      strings.Write(writer);
+      writer.WriteBytes(body.GetData());
+      return writer.GetData();
+    }
+
+
+    std::shared_ptr<CapturedData> TryDeserialize(const std::vector<uint8_t>& content, const uint64_t key, const IO::Path& filename,
+                                                 const std::vector<IO::Path>& includePaths, const CaptureConfig& captureConfig,
+                                                 const VersionRecord& version)
+    {
+      BinaryReader reader(content);
+      if (reader.ReadUInt32() != CACHE_MAGIC || reader.ReadUInt32() != CACHE_FORMAT_VERSION || reader.ReadUInt64() != key)
+        return std::shared_ptr<CapturedData>();
+
+      const StringTable strings(reader);
+
+      // Validate that none of the included files were modified since the entry was written
+      const auto dependencyCount = reader.ReadUInt32();
+      for (uint32_t i = 0; i < dependencyCount; ++i)
+      {
+        const IO::Path dependency(strings.Read(reader));
+        const auto hash = reader.ReadUInt64();
+        if (!IO::File::Exists(dependency) || HashUtil::HashFileContent(dependency) != hash)
+          return std::shared_ptr<CapturedData>();
+      }
+
+      std::vector<FunctionRecord> functions;
+      const auto functionCount = reader.ReadUInt32();
+      functions.reserve(functionCount);
+      for (uint32_t i = 0; i < functionCount; ++i)
+        functions.push_back(ReadFunction(reader, strings));
+
+      std::vector<StructRecord> structs;
+      const auto structCount = reader.ReadUInt32();
+      structs.reserve(structCount);
+      for (uint32_t i = 0; i < structCount; ++i)
+        structs.push_back(ReadStruct(reader, strings));
+
+      std::unordered_map<std::string, StructRecord> structDict;
+      const auto structDictCount = reader.ReadUInt32();
+      for (uint32_t i = 0; i < structDictCount; ++i)
+      {
+        const auto& name = strings.Read(reader);
+        structDict[name] = ReadStruct(reader, strings);
+      }
+
+      std::unordered_map<std::string, EnumRecord> enumDict;
+      const auto enumDictCount = reader.ReadUInt32();
+      for (uint32_t i = 0; i < enumDictCount; ++i)
+      {
+        const auto& name = strings.Read(reader);
+        enumDict[name] = ReadEnum(reader, strings);
+      }
+
+      if (!reader.IsAtEnd())
+        throw std::runtime_error("The cache entry contains unexpected trailing data");
+
+      return std::make_shared<CapturedData>(filename, includePaths, captureConfig, std::move(functions), std::move(structs), std::move(structDict),
+                                            std::move(enumDict), version);
+    }
+  }
+
+
+  CaptureCache::CaptureCache(const IO::Path& cachePath)
+    : m_cachePath(cachePath)
+  {
+  }
+
+
+  std::shared_ptr<CapturedData> CaptureCache::GetOrCapture(const BasicConfig& basicConfig, const IO::Path& filename,
+                                                           const std::vector<IO::Path>& includePaths, const CaptureConfig& captureConfig,
+                                                           const std::shared_ptr<CustomLog>& customLog, const VersionRecord& version)
+  {
+    const auto key = CalculateKey(filename, includePaths, captureConfig);
+    const auto cacheFile = IO::Path::Combine(m_cachePath, fmt::format("{:016x}.bin", key));
+
+    if (IO::File::Exists(cacheFile))
+    {
+      try
+      {
+        std::vector<uint8_t> content;
+        IO::File::ReadAllBytes(content, cacheFile);
+        auto cached = TryDeserialize(content, key, filename, includePaths, captureConfig, version);
+        if (cached)
+          return cached;
+      }
+      catch (const std::exception& ex)
+      {
+        std::cout << "WARNING: Ignoring capture cache entry '" << cacheFile.ToUTF8String() << "': " << ex.what() << "\n";
+      }
+    }
+
+    auto captured = std::make_shared<CapturedData>(basicConfig, filename, includePaths, captureConfig, customLog, version);
+
+    // Failing to update the cache is not fatal, we just parse the file again next time
+    try
+    {
+      const auto content = Serialize(key, captured->FileData->GetIncludedFiles(), captured->TheCapture);
+      IO::Directory::CreateDir(m_cachePath);
+      // The entry is moved into place so a crash or a concurrent run never leaves a truncated entry behind
+      IOUtil::WriteAllBytesAtomic(cacheFile, content);
+    }
+    catch (const std::exception& ex)
+    {
+      std::cout << "WARNING: Failed to write capture cache entry '" << cacheFile.ToUTF8String() << "': " << ex.what() << "\n";
+    }
+    return captured;
+  }
+}
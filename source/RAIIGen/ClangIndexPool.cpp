@@ -0,0 +1,73 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/ClangIndexPool.hpp>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace MB
+{
+  namespace
+  {
+    std::mutex g_poolLock;
+    std::vector<std::shared_ptr<ClangIndex>> g_freeIndices;
+  }
+
+
+  ClangIndex::ClangIndex()
+    : m_index(clang_createIndex(0, 1))
+  {
+    if (m_index == nullptr)
+      throw std::runtime_error("Failed to create the clang index");
+  }
+
+
+  ClangIndex::~ClangIndex()
+  {
+    clang_disposeIndex(m_index);
+  }
+
+
+  std::shared_ptr<ClangIndex> ClangIndexPool::Acquire()
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_poolLock);
+      if (!g_freeIndices.empty())
+      {
+        auto index = g_freeIndices.back();
+        g_freeIndices.pop_back();
+        return index;
+      }
+    }
+    return std::make_shared<ClangIndex>();
+  }
+
+
+  void ClangIndexPool::Release(const std::shared_ptr<ClangIndex>& index)
+  {
+    if (!index)
+      return;
+    std::lock_guard<std::mutex> lock(g_poolLock);
+    g_freeIndices.push_back(index);
+  }
+}
@@ -0,0 +1,100 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/BlackListMatcher.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/String/StringUtil.hpp>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    std::vector<std::string> GetContainsPatterns(const std::vector<BlackListEntry>& entries)
+    {
+      std::vector<std::string> patterns;
+      for (const auto& entry : entries)
+      {
+        if (entry.MatchRequirement == BlackListMatch::Contains)
+          patterns.push_back(entry.Name);
+      }
+      return patterns;
+    }
+  }
+
+
+  BlackListMatcher::BlackListMatcher()
+  {
+  }
+
+
+  BlackListMatcher::BlackListMatcher(const std::vector<BlackListEntry>& entries)
+    : m_entries(entries)
+    , m_contains(GetContainsPatterns(entries))
+  {
+    for (std::size_t i = 0; i < m_entries.size(); ++i)
+    {
+      const auto& entry = m_entries[i];
+      switch (entry.MatchRequirement)
+      {
+      case BlackListMatch::Exact:
+        m_exact.insert(entry.Name);
+        break;
+      case BlackListMatch::Contains:
+        break;
+      case BlackListMatch::Postfix:
+      case BlackListMatch::PostfixNotEntityName:
+      case BlackListMatch::PostfixNotEntityNameEx:
+        m_reversedPostfixes.Add(entry.Name.rbegin(), entry.Name.rend(), static_cast<uint32_t>(i));
+        break;
+      default:
+        throw NotSupportedException("BlackListMatch type not supported");
+      }
+    }
+  }
+
+
+  bool BlackListMatcher::IsMatch(const std::string& str, const ConfigUtil::CurrentEntityInfo& currentEntityInfo) const
+  {
+    if (!m_exact.empty() && m_exact.find(str) != m_exact.end())
+      return true;
+
+    // Every pattern reached while walking the name backwards is a postfix of it, so only the entity name condition is left to check
+    const auto isPostfixMatch = [this, &currentEntityInfo](const uint32_t entryIndex) {
+      const auto& entry = m_entries[entryIndex];
+      switch (entry.MatchRequirement)
+      {
+      case BlackListMatch::PostfixNotEntityName:
+        return !StringUtil::EndsWith(currentEntityInfo.ClassName, entry.Name);
+      case BlackListMatch::PostfixNotEntityNameEx:
+        return !StringUtil::EndsWith(currentEntityInfo.ClassName, entry.Value);
+      default:
+        return true;
+      }
+    };
+    if (m_reversedPostfixes.AnyPrefixOf(str.rbegin(), str.rend(), isPostfixMatch))
+      return true;
+
+    return !m_contains.IsEmpty() && m_contains.IsFoundIn(str);
+  }
+}
@@ -0,0 +1,85 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/FunctionIndex.hpp>
+#include <RAIIGen/Capture.hpp>
+#include <algorithm>
+
+namespace MB
+{
+  FunctionIndex::FunctionIndex(const Capture& capture)
+    : m_capture(capture)
+  {
+    const auto functions = capture.GetFunctions();
+    m_sortedByName.resize(functions.size());
+    for (std::size_t i = 0; i < functions.size(); ++i)
+      m_sortedByName[i] = static_cast<uint32_t>(i);
+
+    std::stable_sort(m_sortedByName.begin(), m_sortedByName.end(),
+                     [&functions](const uint32_t lhs, const uint32_t rhs) { return functions[lhs].Name.Get() < functions[rhs].Name.Get(); });
+  }
+
+
+  const FunctionRecord* FunctionIndex::TryFind(const Symbol& name) const
+  {
+    return m_capture.TryGetFunction(name);
+  }
+
+
+  const FunctionRecord* FunctionIndex::TryFind(const std::string& name) const
+  {
+    // A name that was never interned can't belong to a captured function
+    Symbol symbol;
+    return Symbol::TryFind(symbol, name) ? m_capture.TryGetFunction(symbol) : nullptr;
+  }
+
+
+  std::vector<uint32_t> FunctionIndex::FindIndicesByPrefix(const std::string& prefix) const
+  {
+    const auto functions = m_capture.GetFunctions();
+
+    // All names that start with the prefix form a continuous range in the sorted array, starting at the first name that is >= prefix
+    auto itr = std::lower_bound(m_sortedByName.begin(), m_sortedByName.end(), prefix,
+                                [&functions](const uint32_t lhs, const std::string& value) { return functions[lhs].Name.Get() < value; });
+
+    std::vector<uint32_t> result;
+    while (itr != m_sortedByName.end() && functions[*itr].Name.Get().compare(0, prefix.size(), prefix) == 0)
+    {
+      result.push_back(*itr);
+      ++itr;
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+
+  std::vector<const FunctionRecord*> FunctionIndex::FindByPrefix(const std::string& prefix) const
+  {
+    const auto functions = m_capture.GetFunctions();
+    const auto indices = FindIndicesByPrefix(prefix);
+
+    std::vector<const FunctionRecord*> result(indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+      result[i] = &functions[indices[i]];
+    return result;
+  }
+}
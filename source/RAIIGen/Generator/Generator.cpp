@@ -22,10 +22,12 @@
 
 #include <RAIIGen/Generator/Generator.hpp>
 #include <RAIIGen/Capture.hpp>
+#include <RAIIGen/Profiler.hpp>
 #include <FslBase/IO/File.hpp>
 #include <algorithm>
 #include <array>
 #include <iostream>
+#include <unordered_map>
 #include <unordered_set>
 #include <string>
 
@@ -39,53 +41,66 @@ namespace MB
 
 
   Generator::Generator(const Capture& capture, const GeneratorConfig& config)
+    : m_functionIndex(capture)
   {
-    std::unordered_set<std::string> matchedFunctionNames;
+    ProfileScope profileScope("FunctionMatching");
+
     const auto functionRecords = capture.GetFunctions();
 
-    for (auto itr = functionRecords.begin(); itr != functionRecords.end(); ++itr)
+    // Use the prefix index to locate every (function, create pattern) match.
+    // The matches are sorted by function and then pattern so they are processed in the same order as a scan of all functions would.
+    std::vector<std::pair<uint32_t, std::size_t>> createMatches;
+    for (std::size_t pairIndex = 0; pairIndex < config.FunctionPairs.size(); ++pairIndex)
     {
-      for (auto itrFunc = config.FunctionPairs.begin(); itrFunc != config.FunctionPairs.end(); ++itrFunc)
-      {
-        if (itr->Name.find(itrFunc->Create) == 0)
-        {
-          matchedFunctionNames.insert(itr->Name);
+      for (const auto functionIndex : m_functionIndex.FindIndicesByPrefix(config.FunctionPairs[pairIndex].Create))
+        createMatches.emplace_back(functionIndex, pairIndex);
+    }
+    std::sort(createMatches.begin(), createMatches.end());
+
+    // If a create function has multiple manual matches the first one is used
+    std::unordered_map<Symbol, const FunctionNamePair*> manualMatches;
+    for (const auto& entry : config.ManualFunctionMatches)
+      manualMatches.emplace(Symbol(entry.Create), &entry);
 
-          std::string objectName = itr->Name.substr(itrFunc->Create.size());
-          std::string destroyMethodName = itrFunc->Destroy + objectName;
+    std::unordered_set<Symbol> matchedFunctionNames;
+    for (const auto& match : createMatches)
+    {
+      const auto& function = functionRecords[match.first];
+      const auto& functionPair = config.FunctionPairs[match.second];
+
+      matchedFunctionNames.insert(function.Name);
+
+      std::string objectName = function.Name.substr(functionPair.Create.size());
+      std::string destroyMethodName = functionPair.Destroy + objectName;
 
-          // First we try to find a matching destroy method for functions that follow the 'standard' pattern
-          const auto itrFind = FindByName(functionRecords, destroyMethodName);
-          if (itrFind != functionRecords.end())
+      // First we try to find a matching destroy method for functions that follow the 'standard' pattern
+      const auto pDestroy = m_functionIndex.TryFind(destroyMethodName);
+      if (pDestroy != nullptr)
+      {
+        m_functionAnalysis.Matched.push_back(MatchedFunctionPair(objectName, function, *pDestroy, MatchType::Auto));
+        matchedFunctionNames.insert(pDestroy->Name);
+      }
+      else
+      {
+        bool found = false;
+        // Check if its a manual supported function
+        const auto itrFind2 = manualMatches.find(function.Name);
+        if (itrFind2 != manualMatches.end())
+        {
+          const auto pManualDestroy = m_functionIndex.TryFind(itrFind2->second->Destroy);
+          if (pManualDestroy != nullptr)
           {
-            m_functionAnalysis.Matched.push_back(MatchedFunctionPair(objectName, *itr, *itrFind, MatchType::Auto));
-            matchedFunctionNames.insert(itrFind->Name);
+            m_functionAnalysis.Matched.push_back(MatchedFunctionPair(objectName, function, *pManualDestroy, MatchType::Manual));
+            matchedFunctionNames.insert(pManualDestroy->Name);
+            found = true;
           }
           else
-          {
-            bool found = false;
-            // Check if its a manual supported function
-            const auto name = itr->Name;
-            const auto itrFind2 = std::find_if(config.ManualFunctionMatches.begin(), config.ManualFunctionMatches.end(),
-                                               [name](const FunctionNamePair& val) { return val.Create == name; });
-            if (itrFind2 != config.ManualFunctionMatches.end())
-            {
-              const auto itrDestroy = FindByName(functionRecords, itrFind2->Destroy);
-              if (itrDestroy != functionRecords.end())
-              {
-                m_functionAnalysis.Matched.push_back(MatchedFunctionPair(objectName, *itr, *itrDestroy, MatchType::Manual));
-                matchedFunctionNames.insert(itrDestroy->Name);
-                found = true;
-              }
-              else
-                std::cout << "WARNING: The manual matched destroy function '" << itrFind2->Destroy << "' was not found.\n";
-            }
+            std::cout << "WARNING: The manual matched destroy function '" << itrFind2->second->Destroy << "' was not found.\n";
+        }
 
-            if (!found)
-            {
-              m_functionAnalysis.MissingDestroy.push_back(itr->Name);
-            }
-          }
+        if (!found)
+        {
+          m_functionAnalysis.MissingDestroy.push_back(function.Name);
         }
       }
     }
@@ -99,12 +114,4 @@ namespace MB
       }
     }
   }
-
-
-  std::deque<FunctionRecord>::const_iterator Generator::FindByName(const std::deque<FunctionRecord>& records, const std::string& name)
-  {
-    return std::find_if(records.begin(), records.end(), [name](const FunctionRecord& val) { return val.Name == name; });
-  }
-
-
 }
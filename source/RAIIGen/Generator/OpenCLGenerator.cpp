@@ -513,8 +513,8 @@ namespace MB
           if (!rLastParam.Type.IsConstQualified && rLastParam.Type.IsPointer && rLastParam.Type.Name == "cl_int")
           {
             rLastParam.ParamType = ParameterType::ErrorCode;
-            rLastParam.Name = "errorCode";
-            rLastParam.ArgumentName = "errorCode";
+            rLastParam.Name = Symbol("errorCode");
+            rLastParam.ArgumentName = Symbol("errorCode");
             std::cout << "ErrorCode output detected " << itr->Name << "\n";
           }
         }
@@ -148,6 +148,9 @@ namespace MB
     std::deque<std::string> filters;
     filters.push_back(CREATE_FUNCTION);
     filters.push_back(DESTROY_FUNCTION);
-    return CaptureConfig(TYPE_NAME_PREFIX, filters, g_functionParameterNameOverride, g_functionParameterTypeOverride, true);
+    CaptureConfig config(TYPE_NAME_PREFIX, filters, g_functionParameterNameOverride, g_functionParameterTypeOverride, true);
+    // The function prototypes are only declared by the GLES headers when this is defined
+    config.ParseConfig.Defines.push_back("GL_GLEXT_PROTOTYPES");
+    return config;
   }
 }
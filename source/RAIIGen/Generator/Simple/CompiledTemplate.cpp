@@ -0,0 +1,308 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/CompiledTemplate.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <stdexcept>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const char* const PLACEHOLDER_MARKER = "##";
+    const std::size_t PLACEHOLDER_MARKER_LENGTH = 2;
+
+    bool IsPlaceholderCharacter(const char ch)
+    {
+      return (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_' || ch == '!';
+    }
+
+
+    //! @brief Try to read a placeholder name that starts at 'startIndex' (just after the opening marker)
+    bool TryReadPlaceholderName(const std::string& text, const std::size_t startIndex, std::size_t& rEndIndex)
+    {
+      std::size_t index = startIndex;
+      while (index < text.size() && IsPlaceholderCharacter(text[index]))
+        ++index;
+
+      if (index == startIndex || text.compare(index, PLACEHOLDER_MARKER_LENGTH, PLACEHOLDER_MARKER) != 0)
+        return false;
+      rEndIndex = index;
+      return true;
+    }
+  }
+
+
+  const std::size_t CompiledTemplate::InvalidSlot;
+
+
+  TemplateSchema::TemplateSchema(std::initializer_list<const char*> names)
+  {
+    m_names.reserve(names.size());
+    for (const auto* pszName : names)
+    {
+      const std::string name(pszName);
+      if (!m_lookup.emplace(name, m_names.size()).second)
+        throw std::invalid_argument("Duplicated template placeholder: " + name);
+      m_names.push_back(name);
+    }
+  }
+
+
+  bool TemplateSchema::TryGetIndex(const std::string& name, std::size_t& rIndex) const
+  {
+    const auto itrFind = m_lookup.find(name);
+    if (itrFind == m_lookup.end())
+      return false;
+    rIndex = itrFind->second;
+    return true;
+  }
+
+
+  std::size_t TemplateSchema::GetIndex(const std::string& name) const
+  {
+    std::size_t index;
+    if (!TryGetIndex(name, index))
+      throw NotFoundException("Unknown template placeholder: ##" + name + "##");
+    return index;
+  }
+
+
+  TemplateValues::TemplateValues(const TemplateSchema& schema)
+    : m_pSchema(&schema)
+    , m_pCache(nullptr)
+    , m_entries(schema.Size())
+  {
+  }
+
+
+  TemplateValues::TemplateValues(const TemplateSchema& schema, CompiledTemplateCache& rCache)
+    : m_pSchema(&schema)
+    , m_pCache(&rCache)
+    , m_entries(schema.Size())
+  {
+    if (&rCache.GetSchema() != &schema)
+      throw std::invalid_argument("The template cache was not created for the schema of the values");
+  }
+
+
+  void TemplateValues::Set(const std::string& name, const std::string& value)
+  {
+    auto& rEntry = m_entries[m_pSchema->GetIndex(name)];
+    rEntry.Value = value;
+    rEntry.Expansion.reset();
+    rEntry.IsSet = true;
+    rEntry.IsOptional = false;
+  }
+
+
+  void TemplateValues::SetOptional(const std::string& name, const std::string& value)
+  {
+    Set(name, value);
+    m_entries[m_pSchema->GetIndex(name)].IsOptional = true;
+  }
+
+
+  void TemplateValues::SetExpanded(const std::string& name, const std::string& value)
+  {
+    Set(name, value);
+
+    // A value without a placeholder marker renders as is, so there is nothing to compile
+    if (value.find(PLACEHOLDER_MARKER) == std::string::npos)
+      return;
+
+    const std::string valueName("##" + name + "##");
+    m_entries[m_pSchema->GetIndex(name)].Expansion =
+      m_pCache != nullptr ? m_pCache->Get(valueName, value) : std::make_shared<CompiledTemplate>(valueName, value, *m_pSchema);
+  }
+
+
+  CompiledTemplate::CompiledTemplate()
+    : m_schemaSize(0)
+    , m_literalLength(0)
+  {
+  }
+
+
+  CompiledTemplate::CompiledTemplate(const std::string& name, const std::string& text, const TemplateSchema& schema)
+    : m_name(name)
+    , m_text(text)
+    , m_schemaSize(schema.Size())
+    , m_referencedSlots(schema.Size(), false)
+    , m_literalLength(0)
+  {
+    std::size_t literalStart = 0;
+    std::size_t searchIndex = 0;
+    while (searchIndex < m_text.size())
+    {
+      const std::size_t markerIndex = m_text.find(PLACEHOLDER_MARKER, searchIndex);
+      if (markerIndex == std::string::npos)
+        break;
+
+      const std::size_t nameIndex = markerIndex + PLACEHOLDER_MARKER_LENGTH;
+      std::size_t nameEndIndex;
+      if (!TryReadPlaceholderName(m_text, nameIndex, nameEndIndex))
+      {
+        searchIndex = markerIndex + 1;
+        continue;
+      }
+
+      const std::string placeholderName = m_text.substr(nameIndex, nameEndIndex - nameIndex);
+      std::size_t slot;
+      if (!schema.TryGetIndex(placeholderName, slot))
+        throw std::runtime_error("Template '" + m_name + "' uses the unknown placeholder ##" + placeholderName + "##");
+
+      if (markerIndex > literalStart)
+      {
+        m_segments.emplace_back(literalStart, markerIndex - literalStart, InvalidSlot);
+        m_literalLength += markerIndex - literalStart;
+      }
+      m_segments.emplace_back(markerIndex, nameEndIndex + PLACEHOLDER_MARKER_LENGTH - markerIndex, slot);
+      m_referencedSlots[slot] = true;
+
+      literalStart = nameEndIndex + PLACEHOLDER_MARKER_LENGTH;
+      searchIndex = literalStart;
+    }
+
+    if (literalStart < m_text.size())
+    {
+      m_segments.emplace_back(literalStart, m_text.size() - literalStart, InvalidSlot);
+      m_literalLength += m_text.size() - literalStart;
+    }
+  }
+
+
+  std::vector<std::string> CompiledTemplate::GetUnusedValueNames(const TemplateValues& values) const
+  {
+    if (values.GetSchema().Size() != m_schemaSize)
+      throw std::invalid_argument("Template '" + m_name + "' was not compiled against the schema of the supplied values");
+
+    // The placeholders inside a expanded value are used as well if the template references the value
+    std::vector<bool> referencedSlots(m_referencedSlots);
+    for (std::size_t slot = 0; slot < m_referencedSlots.size(); ++slot)
+    {
+      if (m_referencedSlots[slot] && values.IsSet(slot) && values.IsExpanded(slot))
+      {
+        const CompiledTemplate& valueTemplate = values.GetExpansion(slot);
+        for (std::size_t valueSlot = 0; valueSlot < referencedSlots.size(); ++valueSlot)
+        {
+          if (valueTemplate.IsReferenced(valueSlot))
+            referencedSlots[valueSlot] = true;
+        }
+      }
+    }
+
+    std::vector<std::string> unusedNames;
+    for (std::size_t slot = 0; slot < referencedSlots.size(); ++slot)
+    {
+      if (values.IsSet(slot) && !values.IsOptional(slot) && !referencedSlots[slot])
+        unusedNames.push_back(values.GetSchema().GetName(slot));
+    }
+    return unusedNames;
+  }
+
+
+  std::string CompiledTemplate::Render(const TemplateValues& values, const UnusedTemplateValues unusedValues) const
+  {
+    if (unusedValues == UnusedTemplateValues::Error)
+    {
+      const auto unusedNames = GetUnusedValueNames(values);
+      if (!unusedNames.empty())
+      {
+        std::string names;
+        for (const auto& name : unusedNames)
+          names += (names.empty() ? "##" : ", ##") + name + "##";
+        throw std::runtime_error("Template '" + m_name + "' does not use the placeholders " + names + " which have a value");
+      }
+    }
+    return RenderValues(values, true);
+  }
+
+
+  std::string CompiledTemplate::RenderValues(const TemplateValues& values, const bool allowExpand) const
+  {
+    if (values.GetSchema().Size() != m_schemaSize)
+      throw std::invalid_argument("Template '" + m_name + "' was not compiled against the schema of the supplied values");
+
+    // Expand the values that contain placeholders themselves and validate that every referenced slot has a value
+    std::unordered_map<std::size_t, std::string> expandedValues;
+    std::size_t totalLength = m_literalLength;
+    for (const auto& segment : m_segments)
+    {
+      if (segment.Slot == InvalidSlot)
+        continue;
+
+      if (!values.IsSet(segment.Slot))
+      {
+        throw std::runtime_error("Template '" + m_name + "' uses the placeholder ##" + values.GetSchema().GetName(segment.Slot) +
+                                 "## which has no value");
+      }
+
+      if (allowExpand && values.IsExpanded(segment.Slot))
+      {
+        auto itrFind = expandedValues.find(segment.Slot);
+        if (itrFind == expandedValues.end())
+          itrFind = expandedValues.emplace(segment.Slot, values.GetExpansion(segment.Slot).RenderValues(values, false)).first;
+        totalLength += itrFind->second.size();
+      }
+      else
+        totalLength += values.GetValue(segment.Slot).size();
+    }
+
+    std::string result;
+    result.reserve(totalLength);
+    for (const auto& segment : m_segments)
+    {
+      if (segment.Slot == InvalidSlot)
+        result.append(m_text, segment.Offset, segment.Length);
+      else if (allowExpand && values.IsExpanded(segment.Slot))
+        result += expandedValues[segment.Slot];
+      else
+        result += values.GetValue(segment.Slot);
+    }
+    return result;
+  }
+
+
+  CompiledTemplateCache::CompiledTemplateCache(const TemplateSchema& schema)
+    : m_pSchema(&schema)
+  {
+  }
+
+
+  std::shared_ptr<const CompiledTemplate> CompiledTemplateCache::Get(const std::string& name, const std::string& text)
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      const auto itrFind = m_templates.find(text);
+      if (itrFind != m_templates.end())
+        return itrFind->second;
+    }
+
+    // Compile outside the lock, if another thread compiled the same text meanwhile its version is kept
+    auto compiled = std::make_shared<const CompiledTemplate>(name, text, *m_pSchema);
+    std::lock_guard<std::mutex> lock(m_lock);
+    return m_templates.emplace(text, std::move(compiled)).first->second;
+  }
+}
@@ -28,12 +28,12 @@
 #include <RAIIGen/Generator/ConfigUtil.hpp>
 #include <RAIIGen/StringHelper.hpp>
 #include <FslBase/Exceptions.hpp>
-#include <FslBase/IO/Directory.hpp>
 #include <FslBase/IO/File.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/String/StringUtil.hpp>
 #include <algorithm>
 #include <unordered_map>
+#include <vector>
 #include <iostream>
 #include <fmt/format.h>
 
@@ -186,14 +186,14 @@ namespace MB
       return headerContent;
     }
 
-    std::unordered_map<uint64_t, EnumValueMemberInfo> FindDuplicatedValues(const std::deque<EnumMemberRecord>& members,
-                                                                           const std::vector<BlackListEntry>& enumMemberBlacklist,
+    std::unordered_map<uint64_t, EnumValueMemberInfo> FindDuplicatedValues(const std::vector<EnumMemberRecord>& members,
+                                                                           const BlackListMatcher& enumMemberBlacklist,
                                                                            const ConfigUtil::CurrentEntityInfo& currentEnumEntityInfo)
     {
       std::unordered_map<uint64_t, EnumValueMemberInfo> valueToNameLookup;
       for (const auto& enumMember : members)
       {
-        if (!ConfigUtil::HasMatchingEntry(enumMember.Name, enumMemberBlacklist, currentEnumEntityInfo))
+        if (!enumMemberBlacklist.IsMatch(enumMember.Name, currentEnumEntityInfo))
         {
           auto itrFind = valueToNameLookup.find(enumMember.UnsignedValue);
           if (itrFind == valueToNameLookup.end())
@@ -228,35 +228,25 @@ namespace MB
     {
       std::string content;
 
-      auto enumDict = capture.GetEnumDict();
       bool isFirst = true;
 
       const std::string endOfLine3 = END_OF_LINE + END_OF_LINE + END_OF_LINE;
 
-      std::vector<std::string> sortedNames(enumDict.size());
-      {
-        std::size_t index = 0;
-        for (const auto& entry : enumDict)
-        {
-          sortedNames[index] = entry.first;
-          ++index;
-        }
-        std::sort(sortedNames.begin(), sortedNames.end());
-      }
+      const std::vector<Symbol> sortedNames = capture.GetSortedEnumNames();
 
 
       for (const auto& entryName : sortedNames)
       {
         std::size_t caseCount = 0;
         ConfigUtil::CurrentEntityInfo currentEnumEntityInfo(entryName);
-        if (!ConfigUtil::HasMatchingEntry(entryName, config.EnumNameBlacklist, currentEnumEntityInfo))
+        if (!config.EnumNameBlacklistMatcher.IsMatch(entryName, currentEnumEntityInfo))
         {
-          const auto itrFind = enumDict.find(entryName);
+          const auto& enumRecord = *capture.TryGetEnum(entryName);
           std::string switchCaseContent;
 
-          auto valueToNameLookup = FindDuplicatedValues(itrFind->second.Members, config.EnumMemberBlacklist, currentEnumEntityInfo);
+          auto valueToNameLookup = FindDuplicatedValues(enumRecord.Members, config.EnumMemberBlacklistMatcher, currentEnumEntityInfo);
 
-          for (const auto& enumMember : itrFind->second.Members)
+          for (const auto& enumMember : enumRecord.Members)
           {
             auto itrDuplication = valueToNameLookup.find(enumMember.UnsignedValue);
             if (itrDuplication != valueToNameLookup.end())
@@ -272,13 +262,13 @@ namespace MB
           if (caseCount > 0)
           {
             std::string methodContent = snippets.Method;
-            if (config.VersionGuard.IsValid && itrFind->second.Version != VersionRecord())
+            if (config.VersionGuard.IsValid && enumRecord.Version != VersionRecord())
             {
               methodContent =
-                fmt::format("#if {0}{1}{2}{1}#endif", config.VersionGuard.ToGuardString(itrFind->second.Version), END_OF_LINE, methodContent);
+                fmt::format("#if {0}{1}{2}{1}#endif", config.VersionGuard.ToGuardString(enumRecord.Version), END_OF_LINE, methodContent);
             }
 
-            StringUtil::Replace(methodContent, "##C_TYPE_NAME##", itrFind->second.Name);
+            StringUtil::Replace(methodContent, "##C_TYPE_NAME##", enumRecord.Name);
             StringUtil::Replace(methodContent, "##CASE_ENTRIES##", switchCaseContent);
             content += (!isFirst ? endOfLine3 : END_OF_LINE) + methodContent;
 
@@ -289,28 +279,20 @@ namespace MB
       }
 
       std::string headerContent = GenerateHeaderFile(config, snippets.Header, dstRootPath, dstFileName, content);
-
-      auto dirName = IO::Path::GetDirectoryName(dstFileName);
-      IO::Directory::CreateDir(dirName);
-
-      IOUtil::WriteAllTextIfChanged(dstFileName, headerContent);
+      IOUtil::WriteAllTextIfChanged(dstFileName, std::move(headerContent));
     }
 
 
     void ProcessMultipleFile(const EnumToStringSnippets& snippets, const Capture& capture, const SimpleGeneratorConfig& config,
                              const IO::Path& dstRootPath, const IO::Path& dstFilePath, const bool useSeperateFiles)
     {
-      IO::Directory::CreateDir(dstFilePath);
-
-      auto enumDict = capture.GetEnumDict();
-
-      for (const auto& entry : enumDict)
+      for (const auto& entry : capture.GetEnumDict())
       {
         std::size_t caseCount = 0;
         ConfigUtil::CurrentEntityInfo currentEnumEntityInfo(entry.first);
-        if (!ConfigUtil::HasMatchingEntry(entry.first, config.EnumNameBlacklist, currentEnumEntityInfo))
+        if (!config.EnumNameBlacklistMatcher.IsMatch(entry.first, currentEnumEntityInfo))
         {
-          auto valueToNameLookup = FindDuplicatedValues(entry.second.Members, config.EnumMemberBlacklist, currentEnumEntityInfo);
+          auto valueToNameLookup = FindDuplicatedValues(entry.second.Members, config.EnumMemberBlacklistMatcher, currentEnumEntityInfo);
 
           std::string switchCaseContent;
           for (const auto& enumMember : entry.second.Members)
@@ -337,7 +319,7 @@ namespace MB
             auto dstFileName = IO::Path::Combine(dstFilePath, entry.first + ".hpp");
             std::string headerContent = GenerateHeaderFile(config, snippets.Header, dstRootPath, dstFileName, methodContent, entry.second.Version);
 
-            IOUtil::WriteAllTextIfChanged(dstFileName, headerContent);
+            IOUtil::WriteAllTextIfChanged(dstFileName, std::move(headerContent));
           }
         }
       }
@@ -236,15 +236,14 @@ namespace MB
 
   FormatToCpp::FormatToCpp(const Capture& capture, const std::string& namespaceName, const IO::Path& templateRoot, const IO::Path& dstFileName)
   {
-    auto enumDict = capture.GetEnumDict();
-    const auto itrFind = enumDict.find("VkFormat");
-    if (itrFind == enumDict.end())
+    const auto pFormatRecord = capture.TryGetEnum("VkFormat");
+    if (pFormatRecord == nullptr)
     {
       std::cout << "VkFormat not found\n";
       return;
     }
 
-    const auto formatRecord = itrFind->second;
+    const auto& formatRecord = *pFormatRecord;
 
     for (auto itr = formatRecord.Members.begin(); itr != formatRecord.Members.end(); ++itr)
     {
@@ -0,0 +1,147 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/PassByPolicy.hpp>
+#include <FslBase/String/StringUtil.hpp>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  PassByPolicy::PassByPolicy()
+  {
+  }
+
+
+  PassByPolicy::PassByPolicy(const PassByPolicyConfig& config)
+    : m_config(config)
+  {
+  }
+
+
+  PassBy PassByPolicy::Decide(const TypeRecord& type) const
+  {
+    if (!type.IsPointer && IsSink(type.Name.Get()))
+    {
+      // A const value can't be moved from
+      return type.IsConstQualified ? PassBy::ConstReference : PassBy::RValueReference;
+    }
+    // Pointers, handles, enums and other scalars are always cheap to copy
+    if (type.IsPointer || type.IsFunctionPointer || !type.IsStruct)
+      return PassBy::Value;
+    return DecideBySize(type.SizeOf);
+  }
+
+
+  PassBy PassByPolicy::DecidePointee(const TypeRecord& pointerType) const
+  {
+    // Only a pointee the callee can't modify and that can be copied bitwise is safe to pass as a copy
+    if (!pointerType.IsConstQualified || !pointerType.IsPointeeTriviallyCopyable)
+      return PassBy::ConstReference;
+    return DecideBySize(pointerType.PointeeSizeOf);
+  }
+
+
+  std::string PassByPolicy::GetArgumentTypeString(const TypeRecord& type) const
+  {
+    const std::string constType = type.IsConstQualified ? type.FullTypeString.Get() : "const " + type.FullTypeString;
+    switch (Decide(type))
+    {
+    case PassBy::ConstReference:
+      return constType + "&";
+    case PassBy::RValueReference:
+      return type.FullTypeString + "&&";
+    case PassBy::Value:
+    default:
+      return constType;
+    }
+  }
+
+
+  std::string PassByPolicy::GetPointeeArgumentTypeString(const TypeRecord& pointerType) const
+  {
+    return DecidePointee(pointerType) == PassBy::Value ? "const " + pointerType.Name : "const " + pointerType.Name + "&";
+  }
+
+
+  std::string PassByPolicy::GetArgumentValue(const TypeRecord& type, const std::string& argumentName) const
+  {
+    return ToArgumentValue(Decide(type), argumentName);
+  }
+
+
+  PassBy PassByPolicy::DecideMember(const MemberVariable& member) const
+  {
+    if (IsSink(member.Type))
+      return PassBy::RValueReference;
+    // A member that is created through a pointer argument stores the pointee
+    if (member.FullType.IsPointer)
+      return member.FullType.IsStruct ? DecideBySize(member.FullType.PointeeSizeOf) : PassBy::Value;
+    return Decide(member.FullType);
+  }
+
+
+  std::string PassByPolicy::GetMemberArgumentTypeString(const MemberVariable& member) const
+  {
+    switch (DecideMember(member))
+    {
+    case PassBy::ConstReference:
+      return "const " + member.Type + "&";
+    case PassBy::RValueReference:
+      return member.Type + "&&";
+    case PassBy::Value:
+    default:
+      return "const " + member.Type;
+    }
+  }
+
+
+  std::string PassByPolicy::GetMemberArgumentValue(const MemberVariable& member) const
+  {
+    return ToArgumentValue(DecideMember(member), member.ArgumentName);
+  }
+
+
+  bool PassByPolicy::IsSink(const std::string& typeName) const
+  {
+    for (const auto& prefix : m_config.SinkTypePrefixes)
+    {
+      if (StringUtil::StartsWith(typeName, prefix))
+        return true;
+    }
+    return false;
+  }
+
+
+  std::string PassByPolicy::ToArgumentValue(const PassBy passBy, const std::string& argumentName)
+  {
+    // A rvalue reference parameter is a lvalue, so it has to be moved to be passed on as a sink
+    return passBy == PassBy::RValueReference ? "std::move(" + argumentName + ")" : argumentName;
+  }
+
+
+  PassBy PassByPolicy::DecideBySize(const int64_t size) const
+  {
+    // Types without a known layout are passed by reference, since they might be large
+    return size >= 0 && size <= m_config.MaxPassByValueSize ? PassBy::Value : PassBy::ConstReference;
+  }
+}
@@ -24,17 +24,23 @@
 #include <RAIIGen/Generator/FunctionNamePair.hpp>
 #include <RAIIGen/Generator/MatchedFunctionPair.hpp>
 #include <RAIIGen/Generator/Simple/AnalyzeMode.hpp>
+#include <RAIIGen/Generator/Simple/ClassSnippets.hpp>
+#include <RAIIGen/Generator/Simple/CompiledTemplate.hpp>
 #include <RAIIGen/Generator/Simple/GenerateMethodCode.hpp>
 #include <RAIIGen/Generator/Simple/MemberVariable.hpp>
 #include <RAIIGen/Generator/Simple/MethodArgument.hpp>
 #include <RAIIGen/Generator/Simple/Snippets.hpp>
+#include <RAIIGen/Generator/Simple/SnippetStore.hpp>
 #include <RAIIGen/Generator/Simple/FullAnalysis.hpp>
 #include <RAIIGen/Generator/Simple/ParamInStruct.hpp>
+#include <RAIIGen/Generator/Simple/PassByPolicy.hpp>
 #include <RAIIGen/Generator/ConfigUtil.hpp>
 #include <RAIIGen/CaseUtil.hpp>
 #include <RAIIGen/Capture.hpp>
 #include <RAIIGen/StringHelper.hpp>
 #include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/ParallelUtil.hpp>
+#include <RAIIGen/Profiler.hpp>
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/IO/Directory.hpp>
 #include <FslBase/IO/File.hpp>
@@ -44,13 +50,17 @@
 #include <algorithm>
 #include <array>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <cassert>
 #include <RAIIGen/Generator/Simple/Enum/EnumToStringLookup.hpp>
 #include <RAIIGen/Generator/Simple/Format/FormatToCpp.hpp>
 #include <RAIIGen/Generator/Simple/Struct/CStructToCpp.hpp>
+#include <RAIIGen/Generator/Simple/Struct/StructLayoutReport.hpp>
+#include <RAIIGen/Generator/Simple/Stub/StubBackendGenerator.hpp>
 
 
 using namespace Fsl;
@@ -117,8 +127,8 @@ namespace MB
     }
 
 
-    MethodArgument CPPifyArgument(const TypeRecord& type, const std::string& argumentName, const bool allowPointerToReferenceConversion,
-                                  const bool allowConstAdd = true)
+    MethodArgument CPPifyArgument(const PassByPolicy& passBy, const TypeRecord& type, const std::string& argumentName,
+                                  const bool allowPointerToReferenceConversion, const bool allowConstAdd = true)
     {
       MethodArgument result;
       result.FullType = type;
@@ -129,7 +139,7 @@ namespace MB
       {
         if (allowPointerToReferenceConversion)
         {
-          result.FullTypeString = "const " + type.Name + "&";
+          result.FullTypeString = passBy.GetPointeeArgumentTypeString(type);
           result.ArgumentName = GetResourceArgumentName(type, argumentName);
           result.ParameterValue = "&" + argumentName;
         }
@@ -140,17 +150,18 @@ namespace MB
           result.ParameterValue = argumentName;
         }
       }
-      else if (type.IsConstQualified)
-        result.FullTypeString = type.FullTypeString;
       else if (allowConstAdd && !type.IsPointer)
-        result.FullTypeString = "const " + type.FullTypeString;
+      {
+        result.FullTypeString = passBy.GetArgumentTypeString(type);
+        result.ParameterValue = passBy.GetArgumentValue(type, argumentName);
+      }
       else
         result.FullTypeString = type.FullTypeString;
       return result;
     }
 
 
-    MethodArgument ToMethodArgument(const ParameterRecord& value, const bool allowPointerToRefConvert = true)
+    MethodArgument ToMethodArgument(const PassByPolicy& passBy, const ParameterRecord& value, const bool allowPointerToRefConvert = true)
     {
       // C++'ify the arguments
       std::string fullTypeString;
@@ -159,35 +170,36 @@ namespace MB
 
       if (allowPointerToRefConvert && value.Type.IsConstQualified && value.Type.IsStruct && value.Type.IsPointer)
       {
-        fullTypeString = "const " + value.Type.Name + "&";
+        fullTypeString = passBy.GetPointeeArgumentTypeString(value.Type);
         argumentName = GetResourceArgumentName(value);
         parameterName = "&" + argumentName;
       }
-      else if (value.Type.IsConstQualified)
-        fullTypeString = value.Type.FullTypeString;
       else if (!value.Type.IsPointer)
-        fullTypeString = "const " + value.Type.FullTypeString;
+      {
+        fullTypeString = passBy.GetArgumentTypeString(value.Type);
+        parameterName = passBy.GetArgumentValue(value.Type, argumentName);
+      }
       else
         fullTypeString = value.Type.FullTypeString;
 
       return MethodArgument(value.Type, fullTypeString, argumentName, parameterName);
     }
 
-    MethodArgument ToMethodArgument(const ParameterRecord& value, const std::vector<std::string>& preserveParameterNames)
+    MethodArgument ToMethodArgument(const PassByPolicy& passBy, const ParameterRecord& value, const std::vector<std::string>& preserveParameterNames)
     {
       bool preserve = std::find(preserveParameterNames.begin(), preserveParameterNames.end(), value.ArgumentName) != preserveParameterNames.end();
-      return ToMethodArgument(value, !preserve);
+      return ToMethodArgument(passBy, value, !preserve);
     }
 
-    MethodArgument ToMethodArgument(const MemberVariable& value)
+    MethodArgument ToMethodArgument(const PassByPolicy& passBy, const MemberVariable& value)
     {
-      return CPPifyArgument(value.FullType, value.ArgumentName, true);
+      return CPPifyArgument(passBy, value.FullType, value.ArgumentName, true);
     }
 
 
-    MethodArgument ToMethodArgument(const MemberRecord& value, const bool allowPointerToReferenceConversion = true)
+    MethodArgument ToMethodArgument(const PassByPolicy& passBy, const MemberRecord& value, const bool allowPointerToReferenceConversion = true)
     {
-      return CPPifyArgument(value.Type, value.ArgumentName, allowPointerToReferenceConversion);
+      return CPPifyArgument(passBy, value.Type, value.ArgumentName, allowPointerToReferenceConversion);
     }
 
 
@@ -201,19 +213,17 @@ namespace MB
     ParamInStruct LookupParameterInStruct(const Capture& capture, const std::deque<MethodArgument>& createParameters,
                                           const ParameterRecord& findParameter)
     {
-      auto structDict = capture.GetStructDict();
-
       for (auto itr = createParameters.begin(); itr != createParameters.end(); ++itr)
       {
         if (itr->FullType.IsStruct)
         {
-          const auto itrStruct = structDict.find(itr->FullType.Name);
-          if (itrStruct != structDict.end())
+          const auto pStruct = capture.TryGetStruct(itr->FullType.Name);
+          if (pStruct != nullptr)
           {
-            for (auto itrStructMembers = itrStruct->second.Members.begin(); itrStructMembers != itrStruct->second.Members.end(); ++itrStructMembers)
+            for (auto itrStructMembers = pStruct->Members.begin(); itrStructMembers != pStruct->Members.end(); ++itrStructMembers)
             {
               if (itrStructMembers->Type == findParameter.Type && itrStructMembers->ArgumentName == findParameter.ArgumentName)
-                return ParamInStruct(*itr, itrStruct->second, *itrStructMembers);
+                return ParamInStruct(*itr, *pStruct, *itrStructMembers);
             }
           }
         }
@@ -234,7 +244,7 @@ namespace MB
         const auto typeName = itr->Type.Name;
         if (itr->ParamType == ParameterType::ErrorCode)
         {
-          auto createArgument = ToMethodArgument(*itr, preserveParameterNames);
+          auto createArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
           if (itr->Type.IsPointer)
             createArgument.ParameterValue = std::string("&") + createArgument.ParameterValue;
           result.CreateArguments.push_back(createArgument);
@@ -271,7 +281,7 @@ namespace MB
 
 
                 {    // Build the create argument
-                  auto createArgument = ToMethodArgument(*itr, preserveParameterNames);
+                  auto createArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
                   if (itr->Type.IsPointer)
                   {
                     if (analyzeMode == AnalyzeMode::VectorInstance)
@@ -288,7 +298,7 @@ namespace MB
                   result.CreateArguments.push_back(createArgument);
                 }
                 {    // Build the destroy argument
-                  auto destroyArgument = ToMethodArgument(*itr, preserveParameterNames);
+                  auto destroyArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
                   if (itrFind->Type.IsPointer)
                   {
                     if (analyzeMode == AnalyzeMode::VectorInstance)
@@ -313,27 +323,27 @@ namespace MB
                 std::cout << "  Param matched: " << itr->Type.Name << " " << itr->ArgumentName << "\n";
 
                 auto member = ToMemberVariable(*itr);
-                auto destroyArgument = ToMethodArgument(*itr, preserveParameterNames);
+                auto destroyArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
 
                 if (analyzeMode == AnalyzeMode::Normal || itr->ArgumentName != paramMemberArrayCountName)
                 {
                   result.AdditionalMemberVariables.push_back(member);
-                  result.MethodArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
-                  result.CreateArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
+                  result.MethodArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
+                  result.CreateArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
                   destroyArgument.ParameterValue = member.Name;
                 }
                 else if (analyzeMode == AnalyzeMode::SingleInstance)
                 {
                   result.AdditionalMemberVariables.push_back(member);
-                  result.MethodArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
-                  result.CreateArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
+                  result.MethodArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
+                  result.CreateArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
                   destroyArgument.ParameterValue = "1";
                 }
                 else
                 {
                   result.AdditionalMemberVariables.push_back(member);
-                  result.MethodArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
-                  result.CreateArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
+                  result.MethodArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
+                  result.CreateArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
                   destroyArgument.ParameterValue = member.Name + ".size()";
                 }
                 rDstMap[itrFind->ArgumentName] = destroyArgument;
@@ -343,11 +353,11 @@ namespace MB
             {
               std::cout << "  Param force ignored: " << itr->Type.Name << "\n";
 
-              auto createArgument = ToMethodArgument(*itr, preserveParameterNames);
+              auto createArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
               createArgument.ParameterValue = "nullptr";
               result.CreateArguments.push_back(createArgument);
 
-              auto destroyArgument = ToMethodArgument(*itr, preserveParameterNames);
+              auto destroyArgument = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
               destroyArgument.ParameterValue = "nullptr";
               rDstMap[itrFind->ArgumentName] = destroyArgument;
             }
@@ -357,8 +367,8 @@ namespace MB
             std::cout << "  Param not matched: " << itr->Type.Name << " name: " << itr->ArgumentName << "\n";
             if (analyzeMode != AnalyzeMode::SingleInstance || itr->ArgumentName != paramMemberArrayCountName)
             {
-              result.MethodArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
-              result.CreateArguments.push_back(ToMethodArgument(*itr, preserveParameterNames));
+              result.MethodArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
+              result.CreateArguments.push_back(ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames));
               if (itr->ArgumentName == paramMemberArrayCountName)
               {
                 result.ResourceCountVariableName = itr->ArgumentName;
@@ -366,7 +376,7 @@ namespace MB
             }
             else if (analyzeMode == AnalyzeMode::SingleInstance)
             {
-              auto arg = ToMethodArgument(*itr, preserveParameterNames);
+              auto arg = ToMethodArgument(config.ArgumentPassing, *itr, preserveParameterNames);
               arg.ParameterValue = "1";
               result.CreateArguments.push_back(arg);
             }
@@ -385,14 +395,14 @@ namespace MB
           auto itrFindAlias = config.TypeNameAliases.find(typeName);
           if (itrFindAlias == config.TypeNameAliases.end())
           {
-            throw NotSupportedException(fmt::format("Could not find created resource parameter for method: {}", functions.Create.Name));
+            throw NotSupportedException(fmt::format("Could not find created resource parameter for method: {}", functions.Create.Name.Get()));
           }
-          typeName = itrFindAlias->second;
+          typeName = Symbol(itrFindAlias->second);
           itrFind = std::find_if(functions.Destroy.Parameters.begin(), functions.Destroy.Parameters.end(),
                                  [typeName](const ParameterRecord& val) { return val.Type.Name == typeName; });
           if (itrFind == functions.Destroy.Parameters.end())
           {
-            throw NotSupportedException(fmt::format("Could not find created resource parameter for method using alias: {}", functions.Create.Name));
+            throw NotSupportedException(fmt::format("Could not find created resource parameter for method using alias: {}", functions.Create.Name.Get()));
           }
         }
 
@@ -402,7 +412,7 @@ namespace MB
                                                        CaseUtil::UpperCaseFirstCharacter(result.IntermediaryName));
 
         {    // Build the destroy argument
-          auto destroyArgument = ToMethodArgument(*itrFind, preserveParameterNames);
+          auto destroyArgument = ToMethodArgument(config.ArgumentPassing, *itrFind, preserveParameterNames);
           if (itrFind->Type.IsPointer)
           {
             if (analyzeMode == AnalyzeMode::VectorInstance)
@@ -449,7 +459,7 @@ namespace MB
           auto found = LookupParameterInStruct(capture, rResult.CreateArguments, *itr);
           auto asMember = ToMemberVariable(found.StructMember);
           asMember.SourceArgumentName = found.SourceParameter.ArgumentName + "." + asMember.ArgumentName;
-          auto asArgument = ToMethodArgument(asMember);
+          auto asArgument = ToMethodArgument(config.ArgumentPassing, asMember);
 
           if (itrCustom != config.RAIIClassCustomizations.end() &&
               itrCustom->StructMemberArrayCountName == asMember.ArgumentName)
@@ -473,7 +483,10 @@ namespace MB
           else
           {
             rResult.AdditionalMemberVariables.push_back(asMember);
-            asArgument.ParameterValue = "m_" + asArgument.ParameterValue;
+            // The destroy call reads the member variable, so a sink must not be moved from
+            asArgument.ParameterValue = config.ArgumentPassing.Decide(asArgument.FullType) == PassBy::RValueReference
+                                          ? asMember.Name
+                                          : "m_" + asArgument.ParameterValue;
             rResult.DestroyArguments.push_back(asArgument);
           }
         }
@@ -499,24 +512,91 @@ namespace MB
       return result;
     }
 
-    bool IsExactStartParameterMatch(const std::deque<MemberVariable>& startParameters, const FunctionRecord& function)
+    //! Build the lookup key for a sequence of leading parameter types
+    std::string ToSignatureKey(const std::deque<MemberVariable>& startParameters)
+    {
+      std::string key;
+      for (const auto& member : startParameters)
+      {
+        key += member.Type;
+        key += '\n';
+      }
+      return key;
+    }
+
+
+    std::string ToSignatureKey(const FunctionRecord& function, const std::size_t numParameters)
+    {
+      assert(numParameters <= function.Parameters.size());
+      std::string key;
+      for (std::size_t paramIndex = 0; paramIndex < numParameters; ++paramIndex)
+      {
+        key += function.Parameters[paramIndex].Type.Name.Get();
+        key += '\n';
+      }
+      return key;
+    }
+
+
+    //! Maps a leading parameter type sequence (the member variable signature of a managed class) to the functions that start with it.
+    //! Candidate lists are stored in the order the functions appear in the source deque.
+    class ParameterTypeIndex
     {
-      if (function.Parameters.size() < startParameters.size())
-        return false;
+      typedef std::unordered_map<std::string, std::vector<std::size_t>> SignatureMap;
+
+      const std::deque<FunctionRecord>& m_functions;
+      std::unordered_map<std::size_t, SignatureMap> m_byLength;
+      std::vector<std::size_t> m_empty;
+
+    public:
+      ParameterTypeIndex(const std::deque<FunctionRecord>& functions, const std::deque<FullAnalysis>& managed)
+        : m_functions(functions)
+      {
+        for (const auto& entry : managed)
+        {
+          const std::size_t numParameters = entry.Result.AllMemberVariables.size();
+          if (m_byLength.find(numParameters) != m_byLength.end())
+            continue;
+
+          auto& rMap = m_byLength[numParameters];
+          for (std::size_t functionIndex = 0; functionIndex < functions.size(); ++functionIndex)
+          {
+            if (functions[functionIndex].Parameters.size() >= numParameters)
+              rMap[ToSignatureKey(functions[functionIndex], numParameters)].push_back(functionIndex);
+          }
+        }
+      }
 
-      for (std::size_t paramIndex = 0; paramIndex < startParameters.size(); ++paramIndex)
+      const FunctionRecord& operator[](const std::size_t functionIndex) const
       {
-        if (function.Parameters[paramIndex].Type.Name != startParameters[paramIndex].Type)
-          return false;
+        return m_functions[functionIndex];
       }
-      return true;
+
+      //! Get the indices of all functions whose leading parameter types exactly match the start parameters
+      const std::vector<std::size_t>& Find(const std::deque<MemberVariable>& startParameters) const
+      {
+        const auto itrLength = m_byLength.find(startParameters.size());
+        if (itrLength == m_byLength.end())
+          throw std::invalid_argument("The parameter type index was not built for this signature length");
+
+        const auto itrFind = itrLength->second.find(ToSignatureKey(startParameters));
+        return itrFind != itrLength->second.end() ? itrFind->second : m_empty;
+      }
+    };
+
+
+    std::unordered_set<std::string> BuildManagedTypeSet(const std::deque<FullAnalysis>& managed)
+    {
+      std::unordered_set<std::string> managedTypes;
+      for (const auto& entry : managed)
+        managedTypes.insert(entry.Result.ResourceMemberVariable.Type);
+      return managedTypes;
     }
 
 
-    bool IsManagedType(const std::deque<FullAnalysis>& managed, const ParameterRecord& parameter)
+    bool IsManagedType(const std::unordered_set<std::string>& managedTypes, const ParameterRecord& parameter)
     {
-      auto func = [parameter](const FullAnalysis& val) { return val.Result.ResourceMemberVariable.Type == parameter.Type.Name; };
-      return std::find_if(managed.begin(), managed.end(), func) != managed.end();
+      return managedTypes.find(parameter.Type.Name.Get()) != managedTypes.end();
     }
 
 
@@ -541,66 +621,65 @@ namespace MB
     }
 
 
-    void FindObjectFunctions(const SimpleGeneratorConfig& config, const FunctionAnalysis& functionAnalysis, std::deque<FullAnalysis>& managed,
-                             FullAnalysis& rResult)
+    void FindObjectFunctions(const SimpleGeneratorConfig& config, const ParameterTypeIndex& parameterTypeIndex,
+                             const std::unordered_set<std::string>& managedTypes, FullAnalysis& rResult)
     {
       std::cout << "Matching functions to " << rResult.Result.ClassName << "\n";
 
       CurrentEntityInfo currentEntityInfo(rResult.Result.ClassName);
 
-      for (auto itr = functionAnalysis.Unmatched.begin(); itr != functionAnalysis.Unmatched.end(); ++itr)
+      // 1. The start parameter types and order must be exactly the same as this objects member variables (the index lookup)
+      // 2. Any following parameter must not be of a 'managed' type (one that we generate a object for)
+      const auto& candidates = parameterTypeIndex.Find(rResult.Result.AllMemberVariables);
+      for (const auto functionIndex : candidates)
       {
-        // 1. The start parameter types and order must be exactly the same as this objects member variables
-        // 2. Any following parameter must not be of a 'managed' type (one that we generate a object for)
-        if (IsExactStartParameterMatch(rResult.Result.AllMemberVariables, *itr))
+        const FunctionRecord& function = parameterTypeIndex[functionIndex];
+        const std::size_t numMembers = rResult.Result.AllMemberVariables.size();
+        if (function.Parameters.size() <= numMembers || !IsManagedType(managedTypes, function.Parameters[numMembers]))
         {
-          const std::size_t numMembers = rResult.Result.AllMemberVariables.size();
-          if (itr->Parameters.size() <= numMembers || !IsManagedType(managed, itr->Parameters[numMembers]))
-          {
-            std::cout << "+ " << itr->Name << "\n";
-            std::string methodName = itr->Name;
-            if (StringUtil::StartsWith(methodName, config.FunctionNamePrefix))
-              methodName = methodName.substr(config.FunctionNamePrefix.size());
+          std::cout << "+ " << function.Name << "\n";
+          std::string methodName = function.Name;
+          if (StringUtil::StartsWith(methodName, config.FunctionNamePrefix))
+            methodName = methodName.substr(config.FunctionNamePrefix.size());
 
-            if (!HasMatchingEntry(methodName, config.FunctionNameBlacklist, currentEntityInfo))
-            {
-              ClassMethod classMethod;
-              classMethod.SourceFunction = *itr;
-              classMethod.Name = methodName;
+          if (!config.FunctionNameBlacklistMatcher.IsMatch(methodName, currentEntityInfo))
+          {
+            ClassMethod classMethod;
+            classMethod.SourceFunction = function;
+            classMethod.Name = methodName;
 
-              AddFunctionGuard(classMethod, config.FunctionGuards);
-              AddFunctionVersionGuard(classMethod, config);
+            AddFunctionGuard(classMethod, config.FunctionGuards);
+            AddFunctionVersionGuard(classMethod, config);
 
-              if (itr->ReturnType.Name == "void")
-                classMethod.Template = ClassMethod::TemplateType::Void;
-              else if (itr->ReturnType.Name == config.ErrorCodeTypeName)
-                classMethod.Template = ClassMethod::TemplateType::Error;
-              else
-              {
-                classMethod.Template = ClassMethod::TemplateType::Type;
-                classMethod.ReturnType = CPPifyArgument(itr->ReturnType, "Return", false, false);
-              }
+            if (function.ReturnType.Name == "void")
+              classMethod.Template = ClassMethod::TemplateType::Void;
+            else if (function.ReturnType.Name == config.ErrorCodeTypeName)
+              classMethod.Template = ClassMethod::TemplateType::Error;
+            else
+            {
+              classMethod.Template = ClassMethod::TemplateType::Type;
+              classMethod.ReturnType = CPPifyArgument(config.ArgumentPassing, function.ReturnType, "Return", false, false);
+            }
 
-              // Convert all the method arguments
-              for (auto& param : itr->Parameters)
-                classMethod.OriginalMethodArguments.push_back(ToMethodArgument(param, false));
+            // Convert all the method arguments
+            for (auto& param : function.Parameters)
+              classMethod.OriginalMethodArguments.push_back(ToMethodArgument(config.ArgumentPassing, param, false));
 
-              // Add the starting params (the members)
-              for (std::size_t paramIndex = 0; paramIndex < rResult.Result.AllMemberVariables.size(); ++paramIndex)
-              {
-                auto argument = ToMethodArgument(rResult.Result.AllMemberVariables[paramIndex]);
-                argument.ParameterValue = rResult.Result.AllMemberVariables[paramIndex].Name;
-                classMethod.CombinedMethodArguments.push_back(argument);
-              }
-              // Add the following params (non members)
-              for (std::size_t paramIndex = rResult.Result.AllMemberVariables.size(); paramIndex < itr->Parameters.size(); ++paramIndex)
-              {
-                const auto argument = ToMethodArgument(itr->Parameters[paramIndex], false);
-                classMethod.MethodArguments.push_back(argument);
-                classMethod.CombinedMethodArguments.push_back(argument);
-              }
-              rResult.ClassMethods.push_back(classMethod);
+            // Add the starting params (the members)
+            for (std::size_t paramIndex = 0; paramIndex < rResult.Result.AllMemberVariables.size(); ++paramIndex)
+            {
+              auto argument = ToMethodArgument(config.ArgumentPassing, rResult.Result.AllMemberVariables[paramIndex]);
+              argument.ParameterValue = rResult.Result.AllMemberVariables[paramIndex].Name;
+              classMethod.CombinedMethodArguments.push_back(argument);
+            }
+            // Add the following params (non members)
+            for (std::size_t paramIndex = rResult.Result.AllMemberVariables.size(); paramIndex < function.Parameters.size(); ++paramIndex)
+            {
+              const auto argument = ToMethodArgument(config.ArgumentPassing, function.Parameters[paramIndex], false);
+              classMethod.MethodArguments.push_back(argument);
+              classMethod.CombinedMethodArguments.push_back(argument);
             }
+            rResult.ClassMethods.push_back(classMethod);
           }
         }
       }
@@ -888,7 +967,6 @@ namespace MB
     {
       // std::cout << "Create function parameter struct analysis\n";
       {
-        auto structDict = capture.GetStructDict();
         for (auto itr = rFullAnalysis.begin(); itr != rFullAnalysis.end(); ++itr)
         {
           const std::string createMethodName = itr->Pair.Create.Name;
@@ -903,25 +981,25 @@ namespace MB
             if (itrParam->FullType.IsStruct)
             {
               UnrolledStruct unrolledStruct(*itrParam);
-              auto itrStruct = structDict.find(itrParam->FullType.Name);
-              if (itrStruct != structDict.end())
+              const auto pStructRecord = capture.TryGetStruct(itrParam->FullType.Name);
+              if (pStructRecord != nullptr)
               {
                 std::cout << "  CreateFunction: " << itr->Pair.Create.Name << " found struct: " << itrParam->FullType.Name << "\n";
-                const auto& structRecord = itrStruct->second;
+                const auto& structRecord = *pStructRecord;
                 for (auto itrStruct = structRecord.Members.begin(); itrStruct != structRecord.Members.end(); ++itrStruct)
                 {
                   if (itrStruct->Name != "sType" && itrStruct->Name != "pNext")
                   {
                     if (itrCustom != config.RAIIClassCustomizations.end() && itrCustom->StructMemberArrayCountName == itrStruct->ArgumentName)
                     {
-                      const auto argument = ToMethodArgument(*itrStruct, false);
+                      const auto argument = ToMethodArgument(config.ArgumentPassing, *itrStruct, false);
                       switch (itr->Mode)
                       {
                       case AnalyzeMode::SingleInstance:
-                        unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Counter1, ToMethodArgument(*itrStruct, false)));
+                        unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Counter1, ToMethodArgument(config.ArgumentPassing, *itrStruct, false)));
                         break;
                       case AnalyzeMode::VectorInstance:
-                        unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Size, ToMethodArgument(*itrStruct, false)));
+                        unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Size, ToMethodArgument(config.ArgumentPassing, *itrStruct, false)));
                         unrolledCreateMethod.MethodArguments.push_back(argument);
                         break;
                       default:
@@ -930,16 +1008,16 @@ namespace MB
                     }
                     else
                     {
-                      const auto argument = ToMethodArgument(*itrStruct, false);
+                      const auto argument = ToMethodArgument(config.ArgumentPassing, *itrStruct, false);
                       if (uniqueNames.find(argument.ArgumentName) != uniqueNames.end())
                         throw std::runtime_error("Unique name clash");
                       uniqueNames.insert(argument.ArgumentName);
                       unrolledCreateMethod.MethodArguments.push_back(argument);
-                      unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Unrolled, ToMethodArgument(*itrStruct, false)));
+                      unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Unrolled, ToMethodArgument(config.ArgumentPassing, *itrStruct, false)));
                     }
                   }
                   else
-                    unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Skipped, ToMethodArgument(*itrStruct, false)));
+                    unrolledStruct.Members.push_back(UnrolledStructMember(UnrollMode::Skipped, ToMethodArgument(config.ArgumentPassing, *itrStruct, false)));
                   // std::cout << "    " << itrStruct->Type.FullTypeString << " " << itrStruct->Name << "\n";
                 }
               }
@@ -963,6 +1041,7 @@ namespace MB
     std::deque<FullAnalysis> Analyze(const Capture& capture, const SimpleGeneratorConfig& config, const FunctionAnalysis& functionAnalysis,
                                      std::unordered_set<std::string>& rTypesWithoutDefaultValues)
     {
+      ProfileScope profileScope("Analysis");
       std::deque<FullAnalysis> managed;
       for (auto itr = functionAnalysis.Matched.begin(); itr != functionAnalysis.Matched.end(); ++itr)
       {
@@ -1005,9 +1084,14 @@ namespace MB
       if (config.UnrollCreateStructs)
         AnalyzeCreateFunctionStructParameters(capture, config, managed);
 
-      for (auto itr = managed.begin(); itr != managed.end(); ++itr)
       {
-        FindObjectFunctions(config, functionAnalysis, managed, *itr);
+        ProfileScope objectFunctionsProfileScope("ObjectFunctionMatching");
+        const ParameterTypeIndex parameterTypeIndex(functionAnalysis.Unmatched, managed);
+        const auto managedTypes = BuildManagedTypeSet(managed);
+        for (auto itr = managed.begin(); itr != managed.end(); ++itr)
+        {
+          FindObjectFunctions(config, parameterTypeIndex, managedTypes, *itr);
+        }
       }
 
       return managed;
@@ -1192,25 +1276,25 @@ namespace MB
     }
 
 
-    std::string GenerateMemberAsParameters(const std::deque<MemberVariable>& allMemberVariables, const bool addClaimMode)
+    std::string GenerateMemberAsParameters(const PassByPolicy& passBy, const std::deque<MemberVariable>& allMemberVariables, const bool addClaimMode)
     {
       std::string content(addClaimMode ? "const ClaimMode claimMode, " : "");
 
       for (auto itr = allMemberVariables.begin(); itr != allMemberVariables.end(); ++itr)
       {
-        content += std::string("const ") + itr->Type + " " + itr->ArgumentName;
+        content += passBy.GetMemberArgumentTypeString(*itr) + " " + itr->ArgumentName;
         if ((itr + 1) != allMemberVariables.end())
           content += ", ";
       }
       return content;
     }
 
-    std::string GenerateMemberAsNames(const std::deque<MemberVariable>& allMemberVariables, const bool addClaimMode)
+    std::string GenerateMemberAsNames(const PassByPolicy& passBy, const std::deque<MemberVariable>& allMemberVariables, const bool addClaimMode)
     {
       std::string content(addClaimMode ? "claimMode, " : "");
       for (auto itr = allMemberVariables.begin(); itr != allMemberVariables.end(); ++itr)
       {
-        content += itr->ArgumentName;
+        content += passBy.GetMemberArgumentValue(*itr);
         if ((itr + 1) != allMemberVariables.end())
           content += ", ";
       }
@@ -1316,13 +1400,75 @@ namespace MB
     }
 
 
-    std::string GenerateContent(const SimpleGeneratorConfig& config, const FullAnalysis& fullAnalysis, const std::string& contentTemplate,
+    //! The placeholders that the class header and source templates can use
+    const TemplateSchema& GetContentTemplateSchema()
+    {
+      static const TemplateSchema schema = {"ADDITIONAL_INCLUDES",
+                                            "CLASS_EXTRA_CONSTRUCTORS_HEADER",
+                                            "CLASS_EXTRA_CONSTRUCTORS_SOURCE",
+                                            "CLASS_EXTRA_RESET_METHODS_HEADER",
+                                            "CLASS_EXTRA_RESET_METHODS_SOURCE",
+                                            "CLASS_NAME",
+                                            "CLASS_NAME!",
+                                            "RESOURCE_TYPE",
+                                            "RESOURCE_TYPE_AS_PARAM",
+                                            "RESOURCE_PARAM_NAME",
+                                            "RESOURCE_MEMBER_NAME",
+                                            "CLASS_ADDITIONAL_MEMBER_VARIABLES",
+                                            "CLASS_ADDITIONAL_GET_MEMBER_VARIABLE_METHODS",
+                                            "DEFAULT_VALUE",
+                                            "DESTROY_FUNCTION",
+                                            "RESET_SET_MEMBERS",
+                                            "RESET_SET_MEMBERS_NORMAL",
+                                            "RESOURCE_INTERMEDIARY_NAME",
+                                            "RESET_MEMBER_ASSERTIONS",
+                                            "RESET_INVALIDATE_MEMBERS",
+                                            "MOVE_ASSIGNMENT_CLAIM_MEMBERS",
+                                            "MOVE_ASSIGNMENT_INVALIDATE_MEMBERS",
+                                            "MOVE_CONSTRUCTOR_MEMBER_INITIALIZATION",
+                                            "MOVE_CONSTRUCTOR_INVALIDATE_MEMBERS",
+                                            "DEFAULT_CONSTRUCTOR_MEMBER_INITIALIZATION",
+                                            "DESTROY_FUNCTION_ARGUMENTS",
+                                            "AG_TOOL_STATEMENT",
+                                            "MEMBER_PARAMETERS",
+                                            "MEMBER_PARAMETER_NAMES",
+                                            "NAMESPACE_NAME",
+                                            "NAMESPACE_NAME!",
+                                            "HANDLE_CLASS_NAME",
+                                            "RESOURCE_COUNT",
+                                            "ADDITIONAL_METHODS_HEADER",
+                                            "ADDITIONAL_METHODS_SOURCE",
+                                            "VERSION_GUARD_BEGIN",
+                                            "VERSION_GUARD_END"};
+      return schema;
+    }
+
+
+    const TemplateSchema& GetResetModeTemplateSchema()
+    {
+      static const TemplateSchema schema = {"API_NAME",
+                                            "API_VERSION",
+                                            "PROGRAM_NAME",
+                                            "PROGRAM_VERSION",
+                                            "NAMESPACE_NAME",
+                                            "NAMESPACE_NAME!",
+                                            "AG_TOOL_STATEMENT"};
+      return schema;
+    }
+
+
+    CompiledTemplate LoadContentTemplate(const IO::Path& path)
+    {
+      return CompiledTemplate(path.ToUTF8String(), IO::File::ReadAllText(path), GetContentTemplateSchema());
+    }
+
+
+    std::string GenerateContent(const SimpleGeneratorConfig& config, const FullAnalysis& fullAnalysis, const CompiledTemplate& contentTemplate,
                                 const std::string* const pSnippetMemberVariable, const std::string* const pSnippetMemberVariableGet,
-                                const Snippets& snippets, const AdditionalContent& additionalContent)
+                                const ClassSnippets& classSnippets, const AdditionalContent& additionalContent,
+                                CompiledTemplateCache& rExpandedValueCache)
     {
-      // Generate the RAII resource class header file
-      std::string content = contentTemplate;
-
+      const Snippets& snippets = classSnippets.GetBase();
       std::string classAdditionalMemberVariables;
       std::string classAdditionalGetMemberVariablesMethods;
       {
@@ -1348,19 +1494,9 @@ namespace MB
       }
 
 
-      std::string resetMemberHeader;
-      std::string resetMemberSource;
-      switch (fullAnalysis.Mode)
-      {
-      case AnalyzeMode::VectorInstance:
-        resetMemberHeader = snippets.ResetMemberHeaderVector;
-        resetMemberSource = snippets.ResetMemberSourceVector;
-        break;
-      default:
-        resetMemberHeader = snippets.ResetMemberHeader;
-        resetMemberSource = snippets.ResetMemberSource;
-        break;
-      }
+      const bool isVectorInstance = fullAnalysis.Mode == AnalyzeMode::VectorInstance;
+      const std::string& resetMemberHeader = isVectorInstance ? snippets.ResetMemberHeaderVector : classSnippets.GetResetMemberHeader();
+      const std::string& resetMemberSource = isVectorInstance ? snippets.ResetMemberSourceVector : classSnippets.GetResetMemberSource();
 
       std::string additionalMethodsHeader = GenerateAdditionalMethods(config, fullAnalysis, snippets.AdditionalMethodHeader);
       const std::string additionalMethodsSource = GenerateAdditionalMethods(config, fullAnalysis, snippets.AdditionalMethodSource);
@@ -1370,10 +1506,12 @@ namespace MB
         additionalMethodsHeader += END_OF_LINE + END_OF_LINE + END_OF_LINE + additionalContent.Methods;
       }
 
-      const auto resourceAsArgument = ToMethodArgument(fullAnalysis.Result.ResourceMemberVariable);
+      const auto resourceAsArgument = ToMethodArgument(config.ArgumentPassing, fullAnalysis.Result.ResourceMemberVariable);
 
-      const std::string memberParameters = GenerateMemberAsParameters(fullAnalysis.Result.AllMemberVariables, config.OwnershipTransferUseClaimMode);
-      const std::string memberParameterNames = GenerateMemberAsNames(fullAnalysis.Result.AllMemberVariables, config.OwnershipTransferUseClaimMode);
+      const std::string memberParameters =
+        GenerateMemberAsParameters(config.ArgumentPassing, fullAnalysis.Result.AllMemberVariables, config.OwnershipTransferUseClaimMode);
+      const std::string memberParameterNames =
+        GenerateMemberAsNames(config.ArgumentPassing, fullAnalysis.Result.AllMemberVariables, config.OwnershipTransferUseClaimMode);
       const std::string resetSetMembers =
         GenerateForAllMembersMoveSupport(snippets, fullAnalysis.Result.AllMemberVariables, snippets.ResetSetMemberVariable,
                                          snippets.ResetSetMemberVariableMove, config.TypeDefaultValues, true);
@@ -1432,45 +1570,51 @@ namespace MB
 
       const std::string additionalIncludes = GenerateAdditionalIncludes(config, snippets, fullAnalysis, additionalContent.Headers);
 
-      StringUtil::Replace(content, "##ADDITIONAL_INCLUDES##", additionalIncludes);
-      StringUtil::Replace(content, "##CLASS_EXTRA_CONSTRUCTORS_HEADER##", classExtraConstructors.Header);
-      StringUtil::Replace(content, "##CLASS_EXTRA_CONSTRUCTORS_SOURCE##", classExtraConstructors.Source);
-      StringUtil::Replace(content, "##CLASS_EXTRA_RESET_METHODS_HEADER##", classExtraResetMethods.Header);
-      StringUtil::Replace(content, "##CLASS_EXTRA_RESET_METHODS_SOURCE##", classExtraResetMethods.Source);
-
-      StringUtil::Replace(content, "##CLASS_NAME##", fullAnalysis.Result.ClassName);
-      StringUtil::Replace(content, "##CLASS_NAME!##", CaseUtil::UpperCase(fullAnalysis.Result.ClassName));
-      StringUtil::Replace(content, "##RESOURCE_TYPE##", fullAnalysis.Result.ResourceMemberVariable.Type);
-      StringUtil::Replace(content, "##RESOURCE_TYPE_AS_PARAM##", resourceAsArgument.FullTypeString);
-      StringUtil::Replace(content, "##RESOURCE_PARAM_NAME##", resourceAsArgument.ArgumentName);
-
-      StringUtil::Replace(content, "##RESOURCE_MEMBER_NAME##", fullAnalysis.Result.ResourceMemberVariable.Name);
-      StringUtil::Replace(content, "##CLASS_ADDITIONAL_MEMBER_VARIABLES##", classAdditionalMemberVariables);
-      StringUtil::Replace(content, "##CLASS_ADDITIONAL_GET_MEMBER_VARIABLE_METHODS##", classAdditionalGetMemberVariablesMethods);
-      ReplaceDefaultValue(content, fullAnalysis.Result.ResourceMemberVariable.Type, config.TypeDefaultValues, snippets);
-
-      StringUtil::Replace(content, "##DESTROY_FUNCTION##", fullAnalysis.Pair.Destroy.Name);
-      StringUtil::Replace(content, "##RESET_SET_MEMBERS##", resetSetMembers);
-      StringUtil::Replace(content, "##RESET_SET_MEMBERS_NORMAL##", resetSetMembersNormal);
-      StringUtil::Replace(content, "##RESOURCE_INTERMEDIARY_NAME##", fullAnalysis.Result.IntermediaryName);
-      StringUtil::Replace(content, "##RESET_MEMBER_ASSERTIONS##", resetMemberAssertions);
-      StringUtil::Replace(content, "##RESET_INVALIDATE_MEMBERS##", resetInvalidateMembers);
-      StringUtil::Replace(content, "##MOVE_ASSIGNMENT_CLAIM_MEMBERS##", moveAssignmentClaimMembers);
-      StringUtil::Replace(content, "##MOVE_ASSIGNMENT_INVALIDATE_MEMBERS##", moveAssignmentInvalidateMembers);
-      StringUtil::Replace(content, "##MOVE_CONSTRUCTOR_MEMBER_INITIALIZATION##", moveConstructorMemberInitialization);
-      StringUtil::Replace(content, "##MOVE_CONSTRUCTOR_INVALIDATE_MEMBERS##", moveConstructorInvalidateMembers);
-      StringUtil::Replace(content, "##DEFAULT_CONSTRUCTOR_MEMBER_INITIALIZATION##", defaultConstructorInitialization);
-      StringUtil::Replace(content, "##DESTROY_FUNCTION_ARGUMENTS##", destroyFunctionArguments);
-      StringUtil::Replace(content, "##AG_TOOL_STATEMENT##", config.ToolStatement);
-      StringUtil::Replace(content, "##MEMBER_PARAMETERS##", memberParameters);
-      StringUtil::Replace(content, "##MEMBER_PARAMETER_NAMES##", memberParameterNames);
-      StringUtil::Replace(content, "##NAMESPACE_NAME##", config.NamespaceName);
-      StringUtil::Replace(content, "##NAMESPACE_NAME!##", CaseUtil::UpperCase(config.NamespaceName));
-      StringUtil::Replace(content, "##HANDLE_CLASS_NAME##", snippets.HandleClassName);
-      StringUtil::Replace(content, "##RESOURCE_COUNT##", fullAnalysis.Result.ResourceCountVariableName);
+      // Values that are generated from snippets can themselves contain placeholders, so they are expanded against this table
+      TemplateValues values(GetContentTemplateSchema(), rExpandedValueCache);
+      values.SetExpanded("ADDITIONAL_INCLUDES", additionalIncludes);
+      values.SetExpanded("CLASS_EXTRA_CONSTRUCTORS_HEADER", classExtraConstructors.Header);
+      values.SetExpanded("CLASS_EXTRA_CONSTRUCTORS_SOURCE", classExtraConstructors.Source);
+      values.SetExpanded("CLASS_EXTRA_RESET_METHODS_HEADER", classExtraResetMethods.Header);
+      values.SetExpanded("CLASS_EXTRA_RESET_METHODS_SOURCE", classExtraResetMethods.Source);
+
+      values.Set("CLASS_NAME", fullAnalysis.Result.ClassName);
+      values.Set("CLASS_NAME!", CaseUtil::UpperCase(fullAnalysis.Result.ClassName));
+      values.Set("RESOURCE_TYPE", fullAnalysis.Result.ResourceMemberVariable.Type);
+      values.Set("RESOURCE_TYPE_AS_PARAM", resourceAsArgument.FullTypeString);
+      values.Set("RESOURCE_PARAM_NAME", resourceAsArgument.ArgumentName);
+
+      values.Set("RESOURCE_MEMBER_NAME", fullAnalysis.Result.ResourceMemberVariable.Name);
+      values.SetExpanded("CLASS_ADDITIONAL_MEMBER_VARIABLES", classAdditionalMemberVariables);
+      values.SetExpanded("CLASS_ADDITIONAL_GET_MEMBER_VARIABLE_METHODS", classAdditionalGetMemberVariablesMethods);
+      {
+        std::string defaultValue("##DEFAULT_VALUE##");
+        ReplaceDefaultValue(defaultValue, fullAnalysis.Result.ResourceMemberVariable.Type, config.TypeDefaultValues, snippets);
+        values.Set("DEFAULT_VALUE", defaultValue);
+      }
 
-      StringUtil::Replace(content, "##ADDITIONAL_METHODS_HEADER##", additionalMethodsHeader);
-      StringUtil::Replace(content, "##ADDITIONAL_METHODS_SOURCE##", additionalMethodsSource);
+      values.Set("DESTROY_FUNCTION", fullAnalysis.Pair.Destroy.Name);
+      values.Set("RESET_SET_MEMBERS", resetSetMembers);
+      values.Set("RESET_SET_MEMBERS_NORMAL", resetSetMembersNormal);
+      values.Set("RESOURCE_INTERMEDIARY_NAME", fullAnalysis.Result.IntermediaryName);
+      values.Set("RESET_MEMBER_ASSERTIONS", resetMemberAssertions);
+      values.Set("RESET_INVALIDATE_MEMBERS", resetInvalidateMembers);
+      values.Set("MOVE_ASSIGNMENT_CLAIM_MEMBERS", moveAssignmentClaimMembers);
+      values.Set("MOVE_ASSIGNMENT_INVALIDATE_MEMBERS", moveAssignmentInvalidateMembers);
+      values.Set("MOVE_CONSTRUCTOR_MEMBER_INITIALIZATION", moveConstructorMemberInitialization);
+      values.Set("MOVE_CONSTRUCTOR_INVALIDATE_MEMBERS", moveConstructorInvalidateMembers);
+      values.Set("DEFAULT_CONSTRUCTOR_MEMBER_INITIALIZATION", defaultConstructorInitialization);
+      values.Set("DESTROY_FUNCTION_ARGUMENTS", destroyFunctionArguments);
+      values.Set("AG_TOOL_STATEMENT", config.ToolStatement);
+      values.Set("MEMBER_PARAMETERS", memberParameters);
+      values.Set("MEMBER_PARAMETER_NAMES", memberParameterNames);
+      values.Set("NAMESPACE_NAME", config.NamespaceName);
+      values.Set("NAMESPACE_NAME!", CaseUtil::UpperCase(config.NamespaceName));
+      values.Set("HANDLE_CLASS_NAME", snippets.HandleClassName);
+      values.Set("RESOURCE_COUNT", fullAnalysis.Result.ResourceCountVariableName);
+
+      values.Set("ADDITIONAL_METHODS_HEADER", additionalMethodsHeader);
+      values.Set("ADDITIONAL_METHODS_SOURCE", additionalMethodsSource);
 
       const auto version = fullAnalysis.Pair.Create.Version;
       std::string strVersinGuardBegin;
@@ -1480,10 +1624,10 @@ namespace MB
         strVersinGuardBegin = fmt::format(END_OF_LINE + "#if {0}", config.VersionGuard.ToGuardString(version));
         strVersinGuardEnd = END_OF_LINE + "#endif";
       }
-      StringUtil::Replace(content, "##VERSION_GUARD_BEGIN##", strVersinGuardBegin);
-      StringUtil::Replace(content, "##VERSION_GUARD_END##", strVersinGuardEnd);
+      values.Set("VERSION_GUARD_BEGIN", strVersinGuardBegin);
+      values.Set("VERSION_GUARD_END", strVersinGuardEnd);
 
-      return content;
+      return contentTemplate.Render(values);
     }
 
 
@@ -1536,143 +1680,58 @@ namespace MB
     }
 
 
-    Snippets LoadSnippets(const IO::Path& templateRoot)
-    {
-      const auto pathHeaderSnippetMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_MemberVariable.txt");
-      const auto pathHeaderSnippetMemberVariableGet = IO::Path::Combine(templateRoot, "TemplateSnippet_MemberVariableGet.txt");
-      const auto pathSnippetResetAssertCommand = IO::Path::Combine(templateRoot, "TemplateSnippet_AssertCommand.txt");
-      const auto pathSnippetConstructorMemberInitialization = IO::Path::Combine(templateRoot, "TemplateSnippet_ConstructorMemberInitialization.txt");
-      const auto pathSnippetConstructorMemberInitializationPOD =
-        IO::Path::Combine(templateRoot, "TemplateSnippet_ConstructorMemberInitializationPOD.txt");
-      const auto pathSnippetAdditionalErrorMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalErrorMethodHeader.txt");
-      const auto pathSnippetAdditionalErrorMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalErrorMethodSource.txt");
-      const auto pathSnippetAdditionalTypeMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalTypeMethodHeader.txt");
-      const auto pathSnippetAdditionalTypeMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalTypeMethodSource.txt");
-      const auto pathSnippetAdditionalVoidMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalVoidMethodHeader.txt");
-      const auto pathSnippetAdditionalVoidMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalVoidMethodSource.txt");
-      const auto pathSnippetCreateConstructorHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateConstructorHeader.txt");
-      const auto pathSnippetCreateConstructorSource = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateConstructorSource.txt");
-      const auto pathSnippetResetSetMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetSetMemberVariable.txt");
-      const auto pathSnippetResetSetMemberVariableMove = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetSetMemberVariableMove.txt");
-      const auto pathSnippetResetInvalidateMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetInvalidateMemberVariable.txt");
-      const auto pathSnippetResetInvalidateMemberVariablePOD =
-        IO::Path::Combine(templateRoot, "TemplateSnippet_ResetInvalidateMemberVariablePOD.txt");
-      const auto pathSnippetResetMemberAssertConditionPOD = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberAssertConditionPOD.txt");
-      const auto pathSnippetResetMemberAssertConditionVector =
-        IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberAssertConditionVector.txt");
-      const auto pathSnippetResetMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberHeader.txt");
-      const auto pathSnippetResetMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberSource.txt");
-      const auto pathSnippetResetMemberHeaderVector = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberHeaderVector.txt");
-      const auto pathSnippetResetMemberSourceVector = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberSourceVector.txt");
-      const auto pathSnippetResetParamValidation = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamValidation.txt");
-      const auto pathSnippetResetParamAssertConditionComplex = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamAssertConditionVector.txt");
-      const auto pathSnippetResetParamAssertConditionPOD = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamAssertConditionPOD.txt");
-      const auto pathSnippetMoveAssignmentClaimMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentClaimMember.txt");
-      const auto pathSnippetMoveAssignmentClaimMemberMove = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentClaimMemberMove.txt");
-      const auto pathSnippetMoveAssignmentInvalidateMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentInvalidateMember.txt");
-      const auto pathSnippetMoveConstructorInvalidateMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorInvalidateMember.txt");
-      const auto pathSnippetMoveConstructorClaimMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorClaimMember.txt");
-      const auto pathSnippetMoveConstructorClaimMemberMove = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorClaimMemberMove.txt");
-      const auto pathSnippetHandleClassName = IO::Path::Combine(templateRoot, "TemplateSnippet_HandleClassName.txt");
-      const auto pathSnippetCreateVoidConstructorHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateVoidConstructorHeader.txt");
-      const auto pathSnippetCreateVoidConstructorSource = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateVoidConstructorSource.txt");
-      const auto pathSnippetResetVoidMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetVoidMemberHeader.txt");
-      const auto pathSnippetResetVoidMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetVoidMemberSource.txt");
-      const auto pathSnippetResetUnrollMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollMemberHeader.txt");
-      const auto pathSnippetResetUnrollMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollMemberSource.txt");
-      const auto pathSnippetResetUnrollStructVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollStructVariable.txt");
-      const auto pathSnippetDefaultValueMod = IO::Path::Combine(templateRoot, "TemplateSnippet_DefaultValueMod.txt");
-      const auto pathSnippetIncludeResetMode = IO::Path::Combine(templateRoot, "TemplateSnippet_IncludeResetMode.txt");
-      const auto pathSnippetUnrolledWrap = IO::Path::Combine(templateRoot, "TemplateSnippet_UnrolledWrap.txt");
-
-      Snippets snippets(templateRoot);
-      snippets.ConstructorMemberInitialization.Complex = IO::File::ReadAllText(pathSnippetConstructorMemberInitialization);
-      snippets.ConstructorMemberInitialization.POD = IO::File::ReadAllText(pathSnippetConstructorMemberInitializationPOD);
-
-      SnippetMethodContext additionalMethodHeader;
-      additionalMethodHeader.ErrorReturn = IO::File::ReadAllText(pathSnippetAdditionalErrorMethodHeader);
-      additionalMethodHeader.TypeReturn = IO::File::ReadAllText(pathSnippetAdditionalTypeMethodHeader);
-      additionalMethodHeader.VoidReturn = IO::File::ReadAllText(pathSnippetAdditionalVoidMethodHeader);
-      SnippetMethodContext additionalMethodSource;
-      additionalMethodSource.ErrorReturn = IO::File::ReadAllText(pathSnippetAdditionalErrorMethodSource);
-      additionalMethodSource.TypeReturn = IO::File::ReadAllText(pathSnippetAdditionalTypeMethodSource);
-      additionalMethodSource.VoidReturn = IO::File::ReadAllText(pathSnippetAdditionalVoidMethodSource);
-      snippets.AdditionalMethodHeader = additionalMethodHeader;
-      snippets.AdditionalMethodSource = additionalMethodSource;
-      snippets.ResetAssertCommand = IO::File::ReadAllText(pathSnippetResetAssertCommand);
-      snippets.CreateConstructorHeader = IO::File::ReadAllText(pathSnippetCreateConstructorHeader);
-      snippets.CreateConstructorSource = IO::File::ReadAllText(pathSnippetCreateConstructorSource);
-      snippets.ResetSetMemberVariable = IO::File::ReadAllText(pathSnippetResetSetMemberVariable);
-      snippets.ResetSetMemberVariableMove = IO::File::ReadAllText(pathSnippetResetSetMemberVariableMove);
-      snippets.ResetInvalidateMemberVariable.Complex = IO::File::ReadAllText(pathSnippetResetInvalidateMemberVariable);
-      snippets.ResetInvalidateMemberVariable.POD = IO::File::ReadAllText(pathSnippetResetInvalidateMemberVariablePOD);
-      snippets.ResetMemberAssertCondition.Complex = IO::File::ReadAllText(pathSnippetResetMemberAssertConditionVector);
-      snippets.ResetMemberAssertCondition.POD = IO::File::ReadAllText(pathSnippetResetMemberAssertConditionPOD);
-      snippets.ResetMemberHeader = IO::File::ReadAllText(pathSnippetResetMemberHeader);
-      snippets.ResetMemberSource = IO::File::ReadAllText(pathSnippetResetMemberSource);
-      snippets.ResetMemberHeaderVector = IO::File::ReadAllText(pathSnippetResetMemberHeaderVector);
-      snippets.ResetMemberSourceVector = IO::File::ReadAllText(pathSnippetResetMemberSourceVector);
-      snippets.ResetParamValidation = IO::File::ReadAllText(pathSnippetResetParamValidation);
-      snippets.ResetParamAssertCondition.Complex = IO::File::ReadAllText(pathSnippetResetParamAssertConditionComplex);
-      snippets.ResetParamAssertCondition.POD = IO::File::ReadAllText(pathSnippetResetParamAssertConditionPOD);
-      snippets.MoveAssignmentClaimMember = IO::File::ReadAllText(pathSnippetMoveAssignmentClaimMember);
-      snippets.MoveAssignmentClaimMemberMove = IO::File::ReadAllText(pathSnippetMoveAssignmentClaimMemberMove);
-      snippets.MoveAssignmentInvalidateMember = IO::File::ReadAllText(pathSnippetMoveAssignmentInvalidateMember);
-      snippets.MoveConstructorInvalidateMember = IO::File::ReadAllText(pathSnippetMoveConstructorInvalidateMember);
-      snippets.MoveConstructorClaimMember = IO::File::ReadAllText(pathSnippetMoveConstructorClaimMember);
-      snippets.MoveConstructorClaimMemberMove = IO::File::ReadAllText(pathSnippetMoveConstructorClaimMemberMove);
-      snippets.HandleClassName = IO::File::ReadAllText(pathSnippetHandleClassName);
-      snippets.CreateVoidConstructorHeader = IO::File::ReadAllText(pathSnippetCreateVoidConstructorHeader);
-      snippets.CreateVoidConstructorSource = IO::File::ReadAllText(pathSnippetCreateVoidConstructorSource);
-      snippets.ResetVoidMemberHeader = IO::File::ReadAllText(pathSnippetResetVoidMemberHeader);
-      snippets.ResetVoidMemberSource = IO::File::ReadAllText(pathSnippetResetVoidMemberSource);
-      snippets.ResetUnrollMemberHeader = IO::File::ReadAllText(pathSnippetResetUnrollMemberHeader);
-      snippets.ResetUnrollMemberSource = IO::File::ReadAllText(pathSnippetResetUnrollMemberSource);
-      snippets.ResetUnrollStructVariable = IO::File::ReadAllText(pathSnippetResetUnrollStructVariable);
-      snippets.DefaultValueMod = IO::File::ReadAllText(pathSnippetDefaultValueMod);
-      snippets.IncludeResetMode = IO::File::ReadAllText(pathSnippetIncludeResetMode);
-      snippets.UnrolledWrap = IO::File::ReadAllText(pathSnippetUnrolledWrap);
-      snippets.HeaderSnippetMemberVariable = IO::File::ReadAllText(pathHeaderSnippetMemberVariable);
-      snippets.HeaderSnippetMemberVariableGet = IO::File::ReadAllText(pathHeaderSnippetMemberVariableGet);
-      return snippets;
-    }
-
-
-    std::string ResolveMethodOverride(const IO::Path& snippetRoot, const std::string& overrideValue, const std::string& defaultValue)
-    {
-      if (overrideValue.size() <= 0)
-        return defaultValue;
-
-      const auto fullPath = IO::Path::Combine(snippetRoot, overrideValue);
-      return IO::File::ReadAllText(fullPath);
-    }
-
-
-    RAIIClassMethodOverrides ResolveOverrides(const RAIIClassMethodOverrides& methodOverrides, const Snippets& snippets)
-    {
-      RAIIClassMethodOverrides result;
-      result.ResetHeader = ResolveMethodOverride(snippets.SnippetRoot, methodOverrides.ResetHeader, snippets.ResetMemberHeader);
-      result.ResetSource = ResolveMethodOverride(snippets.SnippetRoot, methodOverrides.ResetSource, snippets.ResetMemberSource);
-      return result;
+    //! @brief Get the content of a override snippet file or null if no override was specified
+    std::shared_ptr<const std::string> TryGetSnippetFile(const SnippetStore& snippetStore, const std::string& relativePath)
+    {
+      return !relativePath.empty() ? snippetStore.GetFile(relativePath) : std::shared_ptr<const std::string>();
+    }
+
+
+    AdditionalContent GetAdditionalContent(const AddtionalFileContentMap& additionalFileContent, const IO::Path& fileName)
+    {
+      const auto itrFind = additionalFileContent.find(IO::Path::GetFileName(fileName).ToUTF8String());
+      return itrFind != additionalFileContent.end() ? itrFind->second : AdditionalContent();
     }
 
 
-    std::unordered_map<std::string, RAIIClassMethodOverrides>
-      ResolveOverrides(const std::unordered_map<std::string, RAIIClassMethodOverrides>& classMethodOverrides, const Snippets& snippets)
+    struct GeneratedClassFiles
     {
-      std::unordered_map<std::string, RAIIClassMethodOverrides> map;
-      for (auto& value : classMethodOverrides)
+      IO::Path HeaderFileName;
+      std::string HeaderContent;
+      IO::Path SourceFileName;
+      std::string SourceContent;
+      bool HasSource;
+
+      GeneratedClassFiles()
+        : HasSource(false)
       {
-        map[value.first] = ResolveOverrides(value.second, snippets);
       }
-      return map;
-    }
+    };
 
 
-    AdditionalContent GetAdditionalContent(const AddtionalFileContentMap& additionalFileContent, const IO::Path& fileName)
+    //! @brief Render the header and source file of a class
+    //! @note  Only reads shared state (the expanded value cache is thread safe) so it can be called from multiple threads at once.
+    GeneratedClassFiles GenerateClassFiles(const SimpleGeneratorConfig& config, const FullAnalysis& fullAnalysis, const CompiledTemplate& headerTemplate,
+                                           const CompiledTemplate& sourceTemplate, const ClassSnippets& snippets,
+                                           const AddtionalFileContentMap& additionalFileContent, const IO::Path& dstPath,
+                                           CompiledTemplateCache& rExpandedValueCache)
     {
-      const auto itrFind = additionalFileContent.find(IO::Path::GetFileName(fileName).ToUTF8String());
-      return itrFind != additionalFileContent.end() ? itrFind->second : AdditionalContent();
+      GeneratedClassFiles result;
+      {
+        result.HeaderFileName = IO::Path::Combine(dstPath, fullAnalysis.Result.ClassName + ".hpp");
+        const auto additionalContent = GetAdditionalContent(additionalFileContent, result.HeaderFileName);
+        result.HeaderContent = GenerateContent(config, fullAnalysis, headerTemplate, &snippets.GetBase().HeaderSnippetMemberVariable,
+                                               &snippets.GetBase().HeaderSnippetMemberVariableGet, snippets, additionalContent, rExpandedValueCache);
+      }
+      if (!sourceTemplate.IsEmpty())
+      {
+        result.SourceFileName = IO::Path::Combine(dstPath, fullAnalysis.Result.ClassName + ".cpp");
+        const auto additionalContent = GetAdditionalContent(additionalFileContent, result.SourceFileName);
+        result.SourceContent =
+          GenerateContent(config, fullAnalysis, sourceTemplate, nullptr, nullptr, snippets, additionalContent, rExpandedValueCache);
+        result.HasSource = true;
+      }
+      return result;
     }
   }
 
@@ -1687,8 +1746,7 @@ namespace MB
   {
     const auto additionalFileContent = LoadAdditionalContent(templateRoot);
 
-    const Snippets snippets = LoadSnippets(templateRoot);
-    const auto resolvedClassMethodOverrides = ResolveOverrides(config.ClassMethodOverrides, snippets);
+    const auto snippetStore = SnippetStore::Get(templateRoot);
 
     const auto pathHeader0 = IO::Path::Combine(templateRoot, "Template_header0.hpp");
     const auto pathSource0 = IO::Path::Combine(templateRoot, "Template_source0.cpp");
@@ -1696,17 +1754,18 @@ namespace MB
     const auto pathSource1Vector = IO::Path::Combine(templateRoot, "Template_source1Vector.cpp");
     const auto pathHeader2Vector = IO::Path::Combine(templateRoot, "Template_header2Vector.hpp");
     const auto pathSource2Vector = IO::Path::Combine(templateRoot, "Template_source2Vector.cpp");
-    const auto headerTemplate0 = IO::File::ReadAllText(pathHeader0);
-    const auto sourceTemplate0 = IO::File::ReadAllText(pathSource0);
-    const auto headerTemplate1Vector = IO::File::ReadAllText(pathHeader1Vector);
-    const auto sourceTemplate1Vector = IO::File::ReadAllText(pathSource1Vector);
-    const auto headerTemplate2Vector = IO::File::ReadAllText(pathHeader2Vector);
-    const auto sourceTemplate2Vector = IO::File::ReadAllText(pathSource2Vector);
+    // The templates are parsed once here and then rendered for each class
+    const auto headerTemplate0 = LoadContentTemplate(pathHeader0);
+    const auto sourceTemplate0 = LoadContentTemplate(pathSource0);
+    const auto headerTemplate1Vector = LoadContentTemplate(pathHeader1Vector);
+    const auto sourceTemplate1Vector = LoadContentTemplate(pathSource1Vector);
+    const auto headerTemplate2Vector = LoadContentTemplate(pathHeader2Vector);
+    const auto sourceTemplate2Vector = LoadContentTemplate(pathSource2Vector);
 
     std::unordered_set<std::string> typesWithoutDefaultValues;
 
-    std::deque<std::string> headerTemplates;
-    std::deque<std::string> sourceTemplates;
+    std::deque<CompiledTemplate> headerTemplates;
+    std::deque<CompiledTemplate> sourceTemplates;
     headerTemplates.push_back(headerTemplate0);
     headerTemplates.push_back(headerTemplate1Vector);
     headerTemplates.push_back(headerTemplate2Vector);
@@ -1717,36 +1776,39 @@ namespace MB
     auto fullAnalysis = Analyze(capture, config, m_functionAnalysis, typesWithoutDefaultValues);
 
 
-    for (auto itr = fullAnalysis.begin(); itr != fullAnalysis.end(); ++itr)
+    // The classes with method overrides get a overlay on top of the shared snippets, the override files are read once by the store
+    const ClassSnippets defaultClassSnippets(snippetStore->GetSnippets());
+    std::unordered_map<std::string, ClassSnippets> classSnippetOverrides;
+    for (const auto& entry : config.ClassMethodOverrides)
     {
-      Snippets classSnippets(snippets);
-      // check if there is any class method overrides and apply the to the snippets if they exist
-      const auto itrFindMethodOverride = resolvedClassMethodOverrides.find(itr->Result.ClassName);
-      if (itrFindMethodOverride != resolvedClassMethodOverrides.end())
-      {
-        classSnippets.ResetMemberHeader = itrFindMethodOverride->second.ResetHeader;
-        classSnippets.ResetMemberSource = itrFindMethodOverride->second.ResetSource;
-      }
+      classSnippetOverrides.emplace(entry.first, ClassSnippets(snippetStore->GetSnippets(), TryGetSnippetFile(*snippetStore, entry.second.ResetHeader),
+                                                               TryGetSnippetFile(*snippetStore, entry.second.ResetSource)));
+    }
 
-      assert(static_cast<std::size_t>(itr->TemplateType) < headerTemplates.size());
-      const auto activeHeaderTemplate = headerTemplates[static_cast<std::size_t>(itr->TemplateType)];
-      {
-        auto fileName = IO::Path::Combine(dstPath, itr->Result.ClassName + ".hpp");
+    // The classes are independent so they are rendered in parallel, the files are then written in the analysis order
+    std::vector<GeneratedClassFiles> generatedClasses(fullAnalysis.size());
+    {
+      // The values generated from snippets repeat between classes (includes, empty sections), so each distinct text is compiled once
+      CompiledTemplateCache expandedValueCache(GetContentTemplateSchema());
+      ProfileScope profileScope("Render");
+      ParallelUtil::ForEachIndex(fullAnalysis.size(), config.WorkerCount, [&](const std::size_t index) {
+        const auto& analysis = fullAnalysis[index];
+        const auto itrFindSnippets = classSnippetOverrides.find(analysis.Result.ClassName);
+        const ClassSnippets& classSnippets = itrFindSnippets != classSnippetOverrides.end() ? itrFindSnippets->second : defaultClassSnippets;
 
-        const auto additionalContent = GetAdditionalContent(additionalFileContent, fileName);
-        auto headerContent = GenerateContent(config, *itr, activeHeaderTemplate, &classSnippets.HeaderSnippetMemberVariable,
-                                             &classSnippets.HeaderSnippetMemberVariableGet, classSnippets, additionalContent);
-        IOUtil::WriteAllTextIfChanged(fileName, headerContent);
-      }
-      assert(static_cast<std::size_t>(itr->TemplateType) < sourceTemplates.size());
-      const auto activeSourceTemplate = sourceTemplates[static_cast<std::size_t>(itr->TemplateType)];
-      if (activeSourceTemplate.size() > 0)
-      {
-        auto fileName = IO::Path::Combine(dstPath, itr->Result.ClassName + ".cpp");
-        const auto additionalContent = GetAdditionalContent(additionalFileContent, fileName);
-        auto sourceContent = GenerateContent(config, *itr, activeSourceTemplate, nullptr, nullptr, classSnippets, additionalContent);
-        IOUtil::WriteAllTextIfChanged(fileName, sourceContent);
-      }
+        assert(static_cast<std::size_t>(analysis.TemplateType) < headerTemplates.size());
+        assert(static_cast<std::size_t>(analysis.TemplateType) < sourceTemplates.size());
+        generatedClasses[index] = GenerateClassFiles(config, analysis, headerTemplates[static_cast<std::size_t>(analysis.TemplateType)],
+                                                     sourceTemplates[static_cast<std::size_t>(analysis.TemplateType)], classSnippets,
+                                                     additionalFileContent, dstPath, expandedValueCache);
+      });
+    }
+
+    for (auto& rGeneratedClass : generatedClasses)
+    {
+      IOUtil::WriteAllTextIfChanged(rGeneratedClass.HeaderFileName, std::move(rGeneratedClass.HeaderContent));
+      if (rGeneratedClass.HasSource)
+        IOUtil::WriteAllTextIfChanged(rGeneratedClass.SourceFileName, std::move(rGeneratedClass.SourceContent));
     }
 
     const auto copyRoot = IO::Path::Combine(templateRoot, "copy");
@@ -1755,46 +1817,47 @@ namespace MB
     {
       if (files.size() > 0)
       {
+        // None of the values contain placeholders so all of them can be substituted in one pass
+        const StringReplacer copyReplacer({{"##API_NAME##", config.APIName},
+                                           {"##API_VERSION##", config.APIVersion},
+                                           {"##CURRENT_API_VERSION_MAJOR##", std::to_string(config.CurrentAPIVersion.Major)},
+                                           {"##CURRENT_API_VERSION_MINOR##", std::to_string(config.CurrentAPIVersion.Minor)},
+                                           {"##CURRENT_API_VERSION_BUILD##", std::to_string(config.CurrentAPIVersion.Build)},
+                                           {"##CURRENT_API_VERSION_HOTFIX##", std::to_string(config.CurrentAPIVersion.Hotfix)},
+                                           {"##PROGRAM_NAME##", config.Program.Name},
+                                           {"##PROGRAM_VERSION##", config.Program.Version},
+                                           {"##NAMESPACE_NAME##", config.NamespaceName},
+                                           {"##NAMESPACE_NAME!##", CaseUtil::UpperCase(config.NamespaceName)},
+                                           {"##AG_TOOL_STATEMENT##", config.ToolStatement}});
+
         for (auto itr = files.begin(); itr != files.end(); ++itr)
         {
-          auto content = IO::File::ReadAllText(**itr);
-
-
-          StringUtil::Replace(content, "##API_NAME##", config.APIName);
-          StringUtil::Replace(content, "##API_VERSION##", config.APIVersion);
-          StringUtil::Replace(content, "##CURRENT_API_VERSION_MAJOR##", std::to_string(config.CurrentAPIVersion.Major));
-          StringUtil::Replace(content, "##CURRENT_API_VERSION_MINOR##", std::to_string(config.CurrentAPIVersion.Minor));
-          StringUtil::Replace(content, "##CURRENT_API_VERSION_BUILD##", std::to_string(config.CurrentAPIVersion.Build));
-          StringUtil::Replace(content, "##CURRENT_API_VERSION_HOTFIX##", std::to_string(config.CurrentAPIVersion.Hotfix));
-          StringUtil::Replace(content, "##PROGRAM_NAME##", config.Program.Name);
-          StringUtil::Replace(content, "##PROGRAM_VERSION##", config.Program.Version);
-          StringUtil::Replace(content, "##NAMESPACE_NAME##", config.NamespaceName);
-          StringUtil::Replace(content, "##NAMESPACE_NAME!##", CaseUtil::UpperCase(config.NamespaceName));
-          StringUtil::Replace(content, "##AG_TOOL_STATEMENT##", config.ToolStatement);
+          auto content = copyReplacer.Replace(IO::File::ReadAllText(**itr));
 
           auto relativeName = (*itr)->ToUTF8String().erase(0, copyRoot.GetByteSize() + 1);
           auto dstDirectory = IO::Path::Combine(dstPath, IO::Path::GetDirectoryName(relativeName));
           auto dstFileName = IO::Path::Combine(dstDirectory, IO::Path::GetFileName(**itr));
-          IO::Directory::CreateDir(dstDirectory);
-          IOUtil::WriteAllTextIfChanged(dstFileName, content);
+          IOUtil::WriteAllTextIfChanged(dstFileName, std::move(content));
         }
       }
     }
 
     const auto pathResetModeHeader = IO::Path::Combine(templateRoot, "TemplateResetMode_header.hpp");
-    const auto resetModeHeaderTemplate = IO::File::ReadAllText(pathResetModeHeader);
-    if (resetModeHeaderTemplate.size() > 0 && IsResetModeRequired(fullAnalysis))
-    {
-      std::string content(resetModeHeaderTemplate);
-      StringUtil::Replace(content, "##API_NAME##", config.APIName);
-      StringUtil::Replace(content, "##API_VERSION##", config.APIVersion);
-      StringUtil::Replace(content, "##PROGRAM_NAME##", config.Program.Name);
-      StringUtil::Replace(content, "##PROGRAM_VERSION##", config.Program.Version);
-      StringUtil::Replace(content, "##NAMESPACE_NAME##", config.NamespaceName);
-      StringUtil::Replace(content, "##NAMESPACE_NAME!##", CaseUtil::UpperCase(config.NamespaceName));
-      StringUtil::Replace(content, "##AG_TOOL_STATEMENT##", config.ToolStatement);
+    const CompiledTemplate resetModeHeaderTemplate(pathResetModeHeader.ToUTF8String(), IO::File::ReadAllText(pathResetModeHeader),
+                                                   GetResetModeTemplateSchema());
+    if (!resetModeHeaderTemplate.IsEmpty() && IsResetModeRequired(fullAnalysis))
+    {
+      // The template has its own value table, so a value it fails to use is reported instead of silently ignored
+      TemplateValues values(GetResetModeTemplateSchema());
+      values.SetOptional("API_NAME", config.APIName);
+      values.SetOptional("API_VERSION", config.APIVersion);
+      values.SetOptional("PROGRAM_NAME", config.Program.Name);
+      values.SetOptional("PROGRAM_VERSION", config.Program.Version);
+      values.SetOptional("NAMESPACE_NAME", config.NamespaceName);
+      values.SetOptional("NAMESPACE_NAME!", CaseUtil::UpperCase(config.NamespaceName));
+      values.Set("AG_TOOL_STATEMENT", config.ToolStatement);
       auto dstFileName = IO::Path::Combine(dstPath, "ResetMode.hpp");
-      IOUtil::WriteAllTextIfChanged(dstFileName, content);
+      IOUtil::WriteAllTextIfChanged(dstFileName, resetModeHeaderTemplate.Render(values, UnusedTemplateValues::Error));
     }
 
     // Write 'Readme.txt'
@@ -1812,7 +1875,7 @@ namespace MB
       StringUtil::Replace(content, "##NAMESPACE_NAME!##", CaseUtil::UpperCase(config.NamespaceName));
       StringUtil::Replace(content, "##AG_TOOL_STATEMENT##", config.ToolStatement);
       auto dstFileName = IO::Path::Combine(dstPath, "RAIIGenVersion.txt");
-      IOUtil::WriteAllTextIfChanged(dstFileName, content);
+      IOUtil::WriteAllTextIfChanged(dstFileName, std::move(content));
     }
 
 
@@ -1824,6 +1887,14 @@ namespace MB
     for (auto itr = sortedTypesWithoutDefaultValues.begin(); itr != sortedTypesWithoutDefaultValues.end(); ++itr)
       std::cout << "WARNING: Missing default value for type: " << *itr << "\n";
 
+    if (config.WriteStructLayoutReport)
+    {
+      auto dstFileNameStructLayout = IO::Path::Combine(dstPath, "RAIIGenStructLayout.txt");
+      StructLayoutReport::Process(capture, dstFileNameStructLayout);
+    }
+
+    StubBackendGenerator::Process(capture, config, m_functionAnalysis, templateRoot, dstPath);
+
     if (config.IsVulkan)
     {
       auto dstFileNameStructTypes = IO::Path::Combine(dstPath, "Vk/Types.hpp");
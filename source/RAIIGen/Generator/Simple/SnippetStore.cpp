@@ -0,0 +1,176 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/SnippetStore.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    std::mutex g_cacheLock;
+    std::unordered_map<std::string, std::shared_ptr<const SnippetStore>> g_cache;
+
+
+    Snippets LoadSnippets(const IO::Path& templateRoot)
+    {
+      const auto pathHeaderSnippetMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_MemberVariable.txt");
+      const auto pathHeaderSnippetMemberVariableGet = IO::Path::Combine(templateRoot, "TemplateSnippet_MemberVariableGet.txt");
+      const auto pathSnippetResetAssertCommand = IO::Path::Combine(templateRoot, "TemplateSnippet_AssertCommand.txt");
+      const auto pathSnippetConstructorMemberInitialization = IO::Path::Combine(templateRoot, "TemplateSnippet_ConstructorMemberInitialization.txt");
+      const auto pathSnippetConstructorMemberInitializationPOD =
+        IO::Path::Combine(templateRoot, "TemplateSnippet_ConstructorMemberInitializationPOD.txt");
+      const auto pathSnippetAdditionalErrorMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalErrorMethodHeader.txt");
+      const auto pathSnippetAdditionalErrorMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalErrorMethodSource.txt");
+      const auto pathSnippetAdditionalTypeMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalTypeMethodHeader.txt");
+      const auto pathSnippetAdditionalTypeMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalTypeMethodSource.txt");
+      const auto pathSnippetAdditionalVoidMethodHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalVoidMethodHeader.txt");
+      const auto pathSnippetAdditionalVoidMethodSource = IO::Path::Combine(templateRoot, "TemplateSnippet_AdditionalVoidMethodSource.txt");
+      const auto pathSnippetCreateConstructorHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateConstructorHeader.txt");
+      const auto pathSnippetCreateConstructorSource = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateConstructorSource.txt");
+      const auto pathSnippetResetSetMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetSetMemberVariable.txt");
+      const auto pathSnippetResetSetMemberVariableMove = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetSetMemberVariableMove.txt");
+      const auto pathSnippetResetInvalidateMemberVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetInvalidateMemberVariable.txt");
+      const auto pathSnippetResetInvalidateMemberVariablePOD =
+        IO::Path::Combine(templateRoot, "TemplateSnippet_ResetInvalidateMemberVariablePOD.txt");
+      const auto pathSnippetResetMemberAssertConditionPOD = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberAssertConditionPOD.txt");
+      const auto pathSnippetResetMemberAssertConditionVector =
+        IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberAssertConditionVector.txt");
+      const auto pathSnippetResetMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberHeader.txt");
+      const auto pathSnippetResetMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberSource.txt");
+      const auto pathSnippetResetMemberHeaderVector = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberHeaderVector.txt");
+      const auto pathSnippetResetMemberSourceVector = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetMemberSourceVector.txt");
+      const auto pathSnippetResetParamValidation = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamValidation.txt");
+      const auto pathSnippetResetParamAssertConditionComplex = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamAssertConditionVector.txt");
+      const auto pathSnippetResetParamAssertConditionPOD = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetParamAssertConditionPOD.txt");
+      const auto pathSnippetMoveAssignmentClaimMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentClaimMember.txt");
+      const auto pathSnippetMoveAssignmentClaimMemberMove = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentClaimMemberMove.txt");
+      const auto pathSnippetMoveAssignmentInvalidateMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveAssignmentInvalidateMember.txt");
+      const auto pathSnippetMoveConstructorInvalidateMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorInvalidateMember.txt");
+      const auto pathSnippetMoveConstructorClaimMember = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorClaimMember.txt");
+      const auto pathSnippetMoveConstructorClaimMemberMove = IO::Path::Combine(templateRoot, "TemplateSnippet_MoveConstructorClaimMemberMove.txt");
+      const auto pathSnippetHandleClassName = IO::Path::Combine(templateRoot, "TemplateSnippet_HandleClassName.txt");
+      const auto pathSnippetCreateVoidConstructorHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateVoidConstructorHeader.txt");
+      const auto pathSnippetCreateVoidConstructorSource = IO::Path::Combine(templateRoot, "TemplateSnippet_CreateVoidConstructorSource.txt");
+      const auto pathSnippetResetVoidMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetVoidMemberHeader.txt");
+      const auto pathSnippetResetVoidMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetVoidMemberSource.txt");
+      const auto pathSnippetResetUnrollMemberHeader = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollMemberHeader.txt");
+      const auto pathSnippetResetUnrollMemberSource = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollMemberSource.txt");
+      const auto pathSnippetResetUnrollStructVariable = IO::Path::Combine(templateRoot, "TemplateSnippet_ResetUnrollStructVariable.txt");
+      const auto pathSnippetDefaultValueMod = IO::Path::Combine(templateRoot, "TemplateSnippet_DefaultValueMod.txt");
+      const auto pathSnippetIncludeResetMode = IO::Path::Combine(templateRoot, "TemplateSnippet_IncludeResetMode.txt");
+      const auto pathSnippetUnrolledWrap = IO::Path::Combine(templateRoot, "TemplateSnippet_UnrolledWrap.txt");
+
+      Snippets snippets(templateRoot);
+      snippets.ConstructorMemberInitialization.Complex = IO::File::ReadAllText(pathSnippetConstructorMemberInitialization);
+      snippets.ConstructorMemberInitialization.POD = IO::File::ReadAllText(pathSnippetConstructorMemberInitializationPOD);
+
+      SnippetMethodContext additionalMethodHeader;
+      additionalMethodHeader.ErrorReturn = IO::File::ReadAllText(pathSnippetAdditionalErrorMethodHeader);
+      additionalMethodHeader.TypeReturn = IO::File::ReadAllText(pathSnippetAdditionalTypeMethodHeader);
+      additionalMethodHeader.VoidReturn = IO::File::ReadAllText(pathSnippetAdditionalVoidMethodHeader);
+      SnippetMethodContext additionalMethodSource;
+      additionalMethodSource.ErrorReturn = IO::File::ReadAllText(pathSnippetAdditionalErrorMethodSource);
+      additionalMethodSource.TypeReturn = IO::File::ReadAllText(pathSnippetAdditionalTypeMethodSource);
+      additionalMethodSource.VoidReturn = IO::File::ReadAllText(pathSnippetAdditionalVoidMethodSource);
+      snippets.AdditionalMethodHeader = additionalMethodHeader;
+      snippets.AdditionalMethodSource = additionalMethodSource;
+      snippets.ResetAssertCommand = IO::File::ReadAllText(pathSnippetResetAssertCommand);
+      snippets.CreateConstructorHeader = IO::File::ReadAllText(pathSnippetCreateConstructorHeader);
+      snippets.CreateConstructorSource = IO::File::ReadAllText(pathSnippetCreateConstructorSource);
+      snippets.ResetSetMemberVariable = IO::File::ReadAllText(pathSnippetResetSetMemberVariable);
+      snippets.ResetSetMemberVariableMove = IO::File::ReadAllText(pathSnippetResetSetMemberVariableMove);
+      snippets.ResetInvalidateMemberVariable.Complex = IO::File::ReadAllText(pathSnippetResetInvalidateMemberVariable);
+      snippets.ResetInvalidateMemberVariable.POD = IO::File::ReadAllText(pathSnippetResetInvalidateMemberVariablePOD);
+      snippets.ResetMemberAssertCondition.Complex = IO::File::ReadAllText(pathSnippetResetMemberAssertConditionVector);
+      snippets.ResetMemberAssertCondition.POD = IO::File::ReadAllText(pathSnippetResetMemberAssertConditionPOD);
+      snippets.ResetMemberHeader = IO::File::ReadAllText(pathSnippetResetMemberHeader);
+      snippets.ResetMemberSource = IO::File::ReadAllText(pathSnippetResetMemberSource);
+      snippets.ResetMemberHeaderVector = IO::File::ReadAllText(pathSnippetResetMemberHeaderVector);
+      snippets.ResetMemberSourceVector = IO::File::ReadAllText(pathSnippetResetMemberSourceVector);
+      snippets.ResetParamValidation = IO::File::ReadAllText(pathSnippetResetParamValidation);
+      snippets.ResetParamAssertCondition.Complex = IO::File::ReadAllText(pathSnippetResetParamAssertConditionComplex);
+      snippets.ResetParamAssertCondition.POD = IO::File::ReadAllText(pathSnippetResetParamAssertConditionPOD);
+      snippets.MoveAssignmentClaimMember = IO::File::ReadAllText(pathSnippetMoveAssignmentClaimMember);
+      snippets.MoveAssignmentClaimMemberMove = IO::File::ReadAllText(pathSnippetMoveAssignmentClaimMemberMove);
+      snippets.MoveAssignmentInvalidateMember = IO::File::ReadAllText(pathSnippetMoveAssignmentInvalidateMember);
+      snippets.MoveConstructorInvalidateMember = IO::File::ReadAllText(pathSnippetMoveConstructorInvalidateMember);
+      snippets.MoveConstructorClaimMember = IO::File::ReadAllText(pathSnippetMoveConstructorClaimMember);
+      snippets.MoveConstructorClaimMemberMove = IO::File::ReadAllText(pathSnippetMoveConstructorClaimMemberMove);
+      snippets.HandleClassName = IO::File::ReadAllText(pathSnippetHandleClassName);
+      snippets.CreateVoidConstructorHeader = IO::File::ReadAllText(pathSnippetCreateVoidConstructorHeader);
+      snippets.CreateVoidConstructorSource = IO::File::ReadAllText(pathSnippetCreateVoidConstructorSource);
+      snippets.ResetVoidMemberHeader = IO::File::ReadAllText(pathSnippetResetVoidMemberHeader);
+      snippets.ResetVoidMemberSource = IO::File::ReadAllText(pathSnippetResetVoidMemberSource);
+      snippets.ResetUnrollMemberHeader = IO::File::ReadAllText(pathSnippetResetUnrollMemberHeader);
+      snippets.ResetUnrollMemberSource = IO::File::ReadAllText(pathSnippetResetUnrollMemberSource);
+      snippets.ResetUnrollStructVariable = IO::File::ReadAllText(pathSnippetResetUnrollStructVariable);
+      snippets.DefaultValueMod = IO::File::ReadAllText(pathSnippetDefaultValueMod);
+      snippets.IncludeResetMode = IO::File::ReadAllText(pathSnippetIncludeResetMode);
+      snippets.UnrolledWrap = IO::File::ReadAllText(pathSnippetUnrolledWrap);
+      snippets.HeaderSnippetMemberVariable = IO::File::ReadAllText(pathHeaderSnippetMemberVariable);
+      snippets.HeaderSnippetMemberVariableGet = IO::File::ReadAllText(pathHeaderSnippetMemberVariableGet);
+      return snippets;
+    }
+  }
+
+
+  SnippetStore::SnippetStore(const IO::Path& templateRoot)
+    : m_templateRoot(templateRoot)
+    , m_snippets(std::make_shared<Snippets>(LoadSnippets(templateRoot)))
+  {
+  }
+
+
+  std::shared_ptr<const SnippetStore> SnippetStore::Get(const IO::Path& templateRoot)
+  {
+    const auto key = templateRoot.ToUTF8String();
+    std::lock_guard<std::mutex> lock(g_cacheLock);
+    auto itrFind = g_cache.find(key);
+    if (itrFind == g_cache.end())
+      itrFind = g_cache.emplace(key, std::make_shared<SnippetStore>(templateRoot)).first;
+    return itrFind->second;
+  }
+
+
+  void SnippetStore::ClearCache()
+  {
+    std::lock_guard<std::mutex> lock(g_cacheLock);
+    g_cache.clear();
+  }
+
+
+  std::shared_ptr<const std::string> SnippetStore::GetFile(const std::string& relativePath) const
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    auto itrFind = m_files.find(relativePath);
+    if (itrFind == m_files.end())
+    {
+      auto content = std::make_shared<std::string>(IO::File::ReadAllText(IO::Path::Combine(m_templateRoot, relativePath)));
+      itrFind = m_files.emplace(relativePath, std::move(content)).first;
+    }
+    return itrFind->second;
+  }
+}
@@ -27,10 +27,10 @@
 #include <RAIIGen/IOUtil.hpp>
 #include <RAIIGen/StringHelper.hpp>
 #include <FslBase/Exceptions.hpp>
-#include <FslBase/IO/Directory.hpp>
 #include <FslBase/IO/File.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/String/StringUtil.hpp>
+#include <fmt/format.h>
 #include <algorithm>
 #include <iostream>
 
@@ -78,19 +78,21 @@ namespace MB
 
     struct AnalyzedStructRecord
     {
-      StructRecord Source;
+      //! Points to the record stored in the capture
+      const StructRecord* pSource;
       std::string CTypeName;
       std::string CppTypeName;
       std::deque<AnalyzedMemberRecord> Members;
       bool UnrollMembersRecursively;
 
       AnalyzedStructRecord()
-        : UnrollMembersRecursively(false)
+        : pSource(nullptr)
+        , UnrollMembersRecursively(false)
       {
       }
 
       AnalyzedStructRecord(const StructRecord& source)
-        : Source(source)
+        : pSource(&source)
         , CTypeName(source.Name)
         , CppTypeName(ToCppName(source.Name))
         , UnrollMembersRecursively(false)
@@ -103,6 +105,74 @@ namespace MB
     };
 
 
+    std::string GetIndentation(const std::string& content)
+    {
+      const auto endIndex = content.find_first_not_of(" \t");
+      return content.substr(0, endIndex != std::string::npos ? endIndex : 0);
+    }
+
+
+    //! @brief Get the size in bytes of a type that has the same size on every ABI
+    //! @return the size or -1 if the size depends on the ABI
+    int64_t GetFixedWidthSize(const TypeRecord& type)
+    {
+      if (type.IsPointer || type.IsFunctionPointer || type.IsStruct)
+        return -1;
+
+      int64_t size = -1;
+      const auto& name = type.Name;
+      if (name == "char" || name == "signed char" || name == "unsigned char" || name == "int8_t" || name == "uint8_t")
+        size = 1;
+      else if (name == "int16_t" || name == "uint16_t")
+        size = 2;
+      else if (name == "int32_t" || name == "uint32_t" || name == "float")
+        size = 4;
+      else if (name == "int64_t" || name == "uint64_t" || name == "double")
+        size = 8;
+      // Don't trust a captured type that doesn't match its name
+      return size == type.SizeOf ? size : -1;
+    }
+
+
+    int64_t AlignUp(const int64_t value, const int64_t alignment)
+    {
+      return ((value + alignment - 1) / alignment) * alignment;
+    }
+
+
+    //! @brief Generate static_asserts that check that the C++ type is layout compatible with the C type and the offsets of the members
+    //!        whose offset is the same on every ABI.
+    //!        The rest of the captured C layout is only valid for the ABI of the capture target, so it is left to the struct layout report.
+    std::string GenerateLayoutChecks(const AnalyzedStructRecord& type, const std::string& indentation)
+    {
+      const auto& cppName = type.CppTypeName;
+      const auto& cName = type.CTypeName;
+      std::string result;
+      result += fmt::format("{0}{1}static_assert(sizeof({2}) == sizeof({3}), \"{2} must have the same size as {3}\");", END_OF_LINE, indentation,
+                            cppName, cName);
+      result += fmt::format("{0}{1}static_assert(alignof({2}) == alignof({3}), \"{2} must have the same alignment as {3}\");", END_OF_LINE,
+                            indentation, cppName, cName);
+
+      // A member offset is decided by the members before it, so the offsets are only ABI independent until the first member whose size
+      // depends on the ABI. Some 32 bit ABIs only align 8 byte members to 4 bytes, so the checks also stop at a 8 byte member that would
+      // need more padding than that.
+      int64_t offset = 0;
+      for (const auto& member : type.pSource->Members)
+      {
+        const auto size = GetFixedWidthSize(member.Type);
+        if (member.IsBitField() || size <= 0)
+          break;
+        const auto memberOffset = AlignUp(offset, size);
+        if (memberOffset != AlignUp(offset, std::min(size, int64_t(4))) || member.OffsetInBits != (memberOffset * 8))
+          break;
+        result += fmt::format("{0}{1}static_assert(offsetof({2}, {3}) == {4}, \"{2}::{3} does not have the expected offset\");", END_OF_LINE,
+                              indentation, cName, member.Name.Get(), memberOffset);
+        offset = memberOffset + size;
+      }
+      return result;
+    }
+
+
     StructSnippets LoadSnippets(const IO::Path& templateRoot)
     {
       StructSnippets snippets;
@@ -303,7 +373,8 @@ namespace MB
   {
     StructSnippets snippets = LoadSnippets(templateRoot);
 
-    auto structs = capture.GetStructs();
+    const auto structs = capture.GetStructs();
+    const auto indentation = GetIndentation(snippets.Struct);
 
     std::vector<std::string> skipTypes = {
       // FIX: these types use "fixed array size" type members  like "char test[2]"
@@ -346,7 +417,7 @@ namespace MB
       StringUtil::Replace(content, "##CPP_TYPE_NAME##", itrFind->second.CppTypeName);
       StringUtil::Replace(content, "##C_TYPE_NAME##", itrFind->second.CTypeName);
       StringUtil::Replace(content, "##PARENT_TYPE_FLAG_INITIALIZATION##", parentTypeFlagInitialization);
-      typeCode += END_OF_LINE + END_OF_LINE + content;
+      typeCode += END_OF_LINE + END_OF_LINE + content + END_OF_LINE + GenerateLayoutChecks(itrFind->second, indentation);
     }
 
     std::string headerContent = snippets.Header;
@@ -358,10 +429,7 @@ namespace MB
 
     // std::cout << headerContent << "\n";
 
-    auto dirName = IO::Path::GetDirectoryName(dstFileName);
-    IO::Directory::CreateDir(dirName);
-
-    IOUtil::WriteAllTextIfChanged(dstFileName, headerContent);
+    IOUtil::WriteAllTextIfChanged(dstFileName, std::move(headerContent));
   }
 
 }
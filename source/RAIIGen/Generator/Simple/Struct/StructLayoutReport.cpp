@@ -0,0 +1,202 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/Struct/StructLayoutReport.hpp>
+#include <RAIIGen/Capture.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/StringHelper.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace MB
+{
+  namespace
+  {
+    const std::size_t CONSOLE_ENTRIES = 10;
+
+    struct StructLayoutInfo
+    {
+      const StructRecord* pRecord;
+      int64_t PaddingBytes;
+      int64_t PackedSize;
+      int64_t CacheLines;
+
+      StructLayoutInfo()
+        : pRecord(nullptr)
+        , PaddingBytes(0)
+        , PackedSize(0)
+        , CacheLines(0)
+      {
+      }
+    };
+
+
+    int64_t AlignUp(const int64_t value, const int64_t alignment)
+    {
+      return ((value + alignment - 1) / alignment) * alignment;
+    }
+
+
+    int64_t GetMemberSizeInBits(const MemberRecord& member)
+    {
+      return member.IsBitField() ? member.BitWidth : member.Type.SizeOf * 8;
+    }
+
+
+    //! @brief Count the bits covered by the members, overlapping members (unions) are only counted once
+    int64_t CalcUsedBits(const StructRecord& record)
+    {
+      std::vector<std::pair<int64_t, int64_t>> ranges;
+      ranges.reserve(record.Members.size());
+      for (const auto& member : record.Members)
+        ranges.emplace_back(member.OffsetInBits, member.OffsetInBits + GetMemberSizeInBits(member));
+      std::sort(ranges.begin(), ranges.end());
+
+      int64_t usedBits = 0;
+      int64_t coveredEnd = 0;
+      for (const auto& range : ranges)
+      {
+        const auto begin = std::max(range.first, coveredEnd);
+        if (range.second > begin)
+        {
+          usedBits += range.second - begin;
+          coveredEnd = range.second;
+        }
+      }
+      return usedBits;
+    }
+
+
+    //! @brief The size the struct would have if its members were ordered by decreasing alignment.
+    //!        A C type size is always a multiple of its alignment, so that order leaves no padding between the members.
+    int64_t CalcPackedSize(const StructRecord& record)
+    {
+      int64_t size = 0;
+      for (const auto& member : record.Members)
+      {
+        // Bit fields can't be reordered freely, so we don't try to improve on the current layout
+        if (member.IsBitField())
+          return record.SizeOf;
+        size += member.Type.SizeOf;
+      }
+      return std::min(AlignUp(size, record.AlignOf), record.SizeOf);
+    }
+
+
+    StructLayoutInfo Analyze(const StructRecord& record)
+    {
+      StructLayoutInfo info;
+      info.pRecord = &record;
+      info.PaddingBytes = (record.SizeOf * 8 - CalcUsedBits(record)) / 8;
+      info.PackedSize = CalcPackedSize(record);
+      info.CacheLines = (record.SizeOf + StructLayoutReport::CacheLineSize - 1) / StructLayoutReport::CacheLineSize;
+      return info;
+    }
+
+
+    std::string FormatEntry(const std::size_t rank, const StructLayoutInfo& info)
+    {
+      const auto& record = *info.pRecord;
+      const double paddingPercentage = record.SizeOf > 0 ? (100.0 * info.PaddingBytes) / record.SizeOf : 0.0;
+      return fmt::format("{:>5} {:<64} {:>6} {:>5} {:>7} {:>7.1f}% {:>6} {:>6}", rank, record.Name.Get(), record.SizeOf, record.AlignOf,
+                         info.PaddingBytes, paddingPercentage, info.PackedSize, info.CacheLines);
+    }
+  }
+
+
+  void StructLayoutReport::Process(const Capture& capture, const Fsl::IO::Path& dstFileName)
+  {
+    std::vector<StructLayoutInfo> entries;
+    std::size_t unknownLayoutCount = 0;
+    for (const auto& record : capture.GetStructs())
+    {
+      if (HasKnownLayout(record))
+        entries.push_back(Analyze(record));
+      else
+        ++unknownLayoutCount;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const StructLayoutInfo& lhs, const StructLayoutInfo& rhs) {
+      if (lhs.PaddingBytes != rhs.PaddingBytes)
+        return lhs.PaddingBytes > rhs.PaddingBytes;
+      if (lhs.pRecord->SizeOf != rhs.pRecord->SizeOf)
+        return lhs.pRecord->SizeOf > rhs.pRecord->SizeOf;
+      return lhs.pRecord->Name.Get() < rhs.pRecord->Name.Get();
+    });
+
+    int64_t totalPadding = 0;
+    for (const auto& entry : entries)
+      totalPadding += entry.PaddingBytes;
+
+    const auto pointerSize = FindPointerSize(capture);
+    const std::string header = fmt::format("{:>5} {:<64} {:>6} {:>5} {:>7} {:>8} {:>6} {:>6}", "Rank", "Struct", "Size", "Align", "Padding",
+                                           "Padding%", "Packed", "Lines");
+
+    std::string content;
+    content += fmt::format("Struct layout report ({} bit pointers, {} byte cache lines){}", pointerSize * 8, CacheLineSize, END_OF_LINE);
+    content += fmt::format("{} structs, {} padding bytes in total, {} structs without a known layout{}", entries.size(), totalPadding,
+                           unknownLayoutCount, END_OF_LINE);
+    content += "Packed is the size the struct would have with its members ordered by decreasing alignment" + END_OF_LINE;
+    content += END_OF_LINE + header + END_OF_LINE;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+      content += FormatEntry(i + 1, entries[i]) + END_OF_LINE;
+
+    if (!entries.empty() && entries.front().PaddingBytes > 0)
+    {
+      std::cout << "Struct layout, worst padding offenders:\n" << header << "\n";
+      for (std::size_t i = 0; i < std::min(entries.size(), CONSOLE_ENTRIES) && entries[i].PaddingBytes > 0; ++i)
+        std::cout << FormatEntry(i + 1, entries[i]) << "\n";
+    }
+
+    IOUtil::WriteAllTextIfChanged(dstFileName, std::move(content));
+  }
+
+
+  bool StructLayoutReport::HasKnownLayout(const StructRecord& record)
+  {
+    if (record.SizeOf <= 0 || record.AlignOf <= 0 || record.Members.empty())
+      return false;
+    for (const auto& member : record.Members)
+    {
+      if (member.OffsetInBits < 0 || (!member.IsBitField() && (member.Type.SizeOf < 0 || member.Type.AlignOf <= 0)))
+        return false;
+    }
+    return true;
+  }
+
+
+  int64_t StructLayoutReport::FindPointerSize(const Capture& capture)
+  {
+    for (const auto& record : capture.GetStructs())
+    {
+      for (const auto& member : record.Members)
+      {
+        if (member.Type.IsPointer && member.Type.SizeOf > 0)
+          return member.Type.SizeOf;
+      }
+    }
+    return 0;
+  }
+}
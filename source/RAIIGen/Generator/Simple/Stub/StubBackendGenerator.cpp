@@ -0,0 +1,581 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Generator/Simple/Stub/StubBackendGenerator.hpp>
+#include <RAIIGen/Capture.hpp>
+#include <RAIIGen/CaseUtil.hpp>
+#include <RAIIGen/Generator/Simple/CompiledTemplate.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/StringHelper.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/String/StringUtil.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const std::size_t INVALID_INDEX = static_cast<std::size_t>(-1);
+
+    enum class StubRole
+    {
+      Other,
+      Create,
+      Destroy
+    };
+
+    enum class HandleLocation
+    {
+      //! The handle is the return value
+      Return,
+      //! The handle is a parameter passed by value
+      Value,
+      //! A single handle is written to or read from a pointer parameter
+      Pointer,
+      //! CountExpression handles are written to or read from a array parameter
+      Array
+    };
+
+    struct StubFunction
+    {
+      StubRole Role;
+      HandleLocation Location;
+      std::size_t HandleParameterIndex;
+      std::string HandleTypeName;
+      std::string CountExpression;
+
+      StubFunction()
+        : Role(StubRole::Other)
+        , Location(HandleLocation::Return)
+        , HandleParameterIndex(INVALID_INDEX)
+        , HandleTypeName()
+        , CountExpression()
+      {
+      }
+
+      StubFunction(const StubRole role, const HandleLocation location, const std::size_t handleParameterIndex, const std::string& handleTypeName)
+        : Role(role)
+        , Location(location)
+        , HandleParameterIndex(handleParameterIndex)
+        , HandleTypeName(handleTypeName)
+        , CountExpression()
+      {
+      }
+    };
+
+
+    //! @brief Get a unique name for every parameter, unnamed parameters get a generated one.
+    //!        The locals of the generated entry points use a 'stub' prefix so they don't clash with these.
+    std::vector<std::string> GetParameterNames(const FunctionRecord& function)
+    {
+      std::vector<std::string> names;
+      std::unordered_set<std::string> usedNames;
+      names.reserve(function.Parameters.size());
+      for (std::size_t i = 0; i < function.Parameters.size(); ++i)
+      {
+        const auto& param = function.Parameters[i];
+        std::string name = param.IsAutoGeneratedName ? std::string() : param.Name.Get();
+        if (name.empty() || !usedNames.insert(name).second)
+          name = fmt::format("param{}", i);
+        names.push_back(name);
+      }
+      return names;
+    }
+
+
+    //! @brief Declare a variable of the given type, function pointers are spelled 'R (*)(A)' and arrays 'T [N]' so the name goes inside them
+    std::string DeclareVariable(const std::string& typeString, const std::string& name)
+    {
+      const auto functionPointerIndex = typeString.find("(*)");
+      if (functionPointerIndex != std::string::npos)
+        return typeString.substr(0, functionPointerIndex + 2) + name + typeString.substr(functionPointerIndex + 2);
+
+      const auto arrayIndex = typeString.find('[');
+      if (arrayIndex != std::string::npos)
+      {
+        auto baseType = typeString.substr(0, arrayIndex);
+        while (!baseType.empty() && baseType.back() == ' ')
+          baseType.pop_back();
+        return baseType + " " + name + typeString.substr(arrayIndex);
+      }
+      return typeString + " " + name;
+    }
+
+
+    //! @brief Locate the parameter of the given type using the same type name aliasing as the class analysis
+    std::size_t FindParameterOfType(const FunctionRecord& function, const Symbol& typeName, const SimpleGeneratorConfig& config)
+    {
+      const auto& parameters = function.Parameters;
+      auto itrFind = std::find_if(parameters.begin(), parameters.end(), [typeName](const ParameterRecord& val) { return val.Type.Name == typeName; });
+      if (itrFind == parameters.end())
+      {
+        auto itrFindAlias = config.TypeNameAliases.find(typeName.Get());
+        if (itrFindAlias != config.TypeNameAliases.end())
+        {
+          const auto& typeAliasName = itrFindAlias->second;
+          itrFind = std::find_if(parameters.begin(), parameters.end(),
+                                 [&typeAliasName](const ParameterRecord& val) { return val.Type.Name == typeAliasName; });
+        }
+      }
+      return itrFind != parameters.end() ? static_cast<std::size_t>(itrFind - parameters.begin()) : INVALID_INDEX;
+    }
+
+
+    std::size_t FindParameterByArgumentName(const FunctionRecord& function, const std::string& argumentName)
+    {
+      if (argumentName.empty())
+        return INVALID_INDEX;
+      for (std::size_t i = 0; i < function.Parameters.size(); ++i)
+      {
+        if (function.Parameters[i].ArgumentName == argumentName)
+          return i;
+      }
+      return INVALID_INDEX;
+    }
+
+
+    const RAIIClassCustomization* TryGetCustomization(const SimpleGeneratorConfig& config, const FunctionRecord& create)
+    {
+      const auto itrFind = std::find_if(config.RAIIClassCustomizations.begin(), config.RAIIClassCustomizations.end(),
+                                        [&create](const RAIIClassCustomization& val) { return val.SourceCreateMethod == create.Name; });
+      return itrFind != config.RAIIClassCustomizations.end() ? &(*itrFind) : nullptr;
+    }
+
+
+    //! @brief Get the expression for the number of handles a array create function produces, empty if it produces one handle.
+    //!        The count is either a parameter or a member of a create info struct parameter as described by the class customization.
+    std::string FindCreateCountExpression(const Capture& capture, const SimpleGeneratorConfig& config, const FunctionRecord& create,
+                                          const std::vector<std::string>& parameterNames)
+    {
+      const auto pCustom = TryGetCustomization(config, create);
+      if (pCustom == nullptr)
+        return std::string();
+
+      const auto paramIndex = FindParameterByArgumentName(create, pCustom->ParamMemberArrayCountName);
+      if (paramIndex != INVALID_INDEX)
+        return parameterNames[paramIndex];
+
+      if (!pCustom->StructMemberArrayCountName.empty())
+      {
+        for (std::size_t i = 0; i < create.Parameters.size(); ++i)
+        {
+          const auto& param = create.Parameters[i];
+          const StructRecord* pStruct = param.Type.IsPointer && param.Type.IsStruct ? capture.TryGetStruct(param.Type.Name.Get()) : nullptr;
+          if (pStruct == nullptr)
+            continue;
+          for (const auto& member : pStruct->Members)
+          {
+            if (member.Name == pCustom->StructMemberArrayCountName)
+              return fmt::format("({0} != nullptr ? {0}->{1} : 0)", parameterNames[i], member.Name.Get());
+          }
+        }
+      }
+      return std::string();
+    }
+
+
+    //! @brief Get the expression for the number of handles a array destroy function receives.
+    //!        The count parameter is named like the create count or else it is the parameter just before the array (the C API convention).
+    std::string FindDestroyCountExpression(const SimpleGeneratorConfig& config, const FunctionRecord& create, const FunctionRecord& destroy,
+                                           const std::size_t handleIndex, const std::vector<std::string>& parameterNames)
+    {
+      const auto pCustom = TryGetCustomization(config, create);
+      if (pCustom != nullptr)
+      {
+        auto paramIndex = FindParameterByArgumentName(destroy, pCustom->StructMemberArrayCountName);
+        if (paramIndex == INVALID_INDEX)
+          paramIndex = FindParameterByArgumentName(destroy, pCustom->ParamMemberArrayCountName);
+        if (paramIndex != INVALID_INDEX)
+          return parameterNames[paramIndex];
+      }
+      if (handleIndex > 0 && !destroy.Parameters[handleIndex - 1].Type.IsPointer && !destroy.Parameters[handleIndex - 1].Type.IsStruct)
+        return parameterNames[handleIndex - 1];
+      return "1";
+    }
+
+
+    StubFunction AnalyzeDestroy(const SimpleGeneratorConfig& config, const FunctionRecord& create, const FunctionRecord& destroy,
+                                const std::size_t handleIndex, const std::string& handleTypeName)
+    {
+      const auto& handleType = destroy.Parameters[handleIndex].Type;
+      if (!handleType.IsPointer)
+        return StubFunction(StubRole::Destroy, HandleLocation::Value, handleIndex, handleTypeName);
+      if (!handleType.IsConstQualified)
+        return StubFunction(StubRole::Destroy, HandleLocation::Pointer, handleIndex, handleTypeName);
+
+      StubFunction result(StubRole::Destroy, HandleLocation::Array, handleIndex, handleTypeName);
+      result.CountExpression = FindDestroyCountExpression(config, create, destroy, handleIndex, GetParameterNames(destroy));
+      return result;
+    }
+
+
+    //! @brief Locate the handle of a create/destroy pair the same way the class analysis does: the non const pointer parameter of the create
+    //!        function whose type the destroy function takes, or else the return value of the create function.
+    bool TryAnalyzePair(const Capture& capture, const SimpleGeneratorConfig& config, const MatchedFunctionPair& functions, StubFunction& rCreate,
+                        StubFunction& rDestroy)
+    {
+      const auto& create = functions.Create;
+      const auto& destroy = functions.Destroy;
+      for (std::size_t i = 0; i < create.Parameters.size(); ++i)
+      {
+        const auto& param = create.Parameters[i];
+        if (param.ParamType == ParameterType::ErrorCode || !param.Type.IsPointer || param.Type.IsConstQualified)
+          continue;
+
+        const auto destroyIndex = FindParameterOfType(destroy, param.Type.Name, config);
+        if (destroyIndex != INVALID_INDEX)
+        {
+          rCreate = StubFunction(StubRole::Create, HandleLocation::Pointer, i, param.Type.Name.Get());
+          rCreate.CountExpression = FindCreateCountExpression(capture, config, create, GetParameterNames(create));
+          if (!rCreate.CountExpression.empty())
+            rCreate.Location = HandleLocation::Array;
+          rDestroy = AnalyzeDestroy(config, create, destroy, destroyIndex, rCreate.HandleTypeName);
+          return true;
+        }
+      }
+
+      if (create.ReturnType.FullTypeString != "void")
+      {
+        const auto destroyIndex = FindParameterOfType(destroy, create.ReturnType.Name, config);
+        if (destroyIndex != INVALID_INDEX)
+        {
+          rCreate = StubFunction(StubRole::Create, HandleLocation::Return, INVALID_INDEX, create.ReturnType.Name.Get());
+          rDestroy = AnalyzeDestroy(config, create, destroy, destroyIndex, rCreate.HandleTypeName);
+          return true;
+        }
+      }
+      return false;
+    }
+
+
+    std::unordered_map<std::string, StubFunction> AnalyzeFunctions(const Capture& capture, const SimpleGeneratorConfig& config,
+                                                                   const FunctionAnalysis& functionAnalysis)
+    {
+      std::unordered_map<std::string, StubFunction> result;
+      for (const auto& functions : functionAnalysis.Matched)
+      {
+        StubFunction create;
+        StubFunction destroy;
+        if (TryAnalyzePair(capture, config, functions, create, destroy))
+        {
+          // A destroy function can be shared by several create functions, the first analysis of it is used
+          result.emplace(functions.Create.Name.Get(), create);
+          result.emplace(functions.Destroy.Name.Get(), destroy);
+        }
+        else
+          std::cout << "WARNING: Stub could not locate the handle of: " << functions.Create.Name << "\n";
+      }
+      return result;
+    }
+
+
+    std::deque<std::string> GetGuards(const SimpleGeneratorConfig& config, const FunctionRecord& function)
+    {
+      std::deque<std::string> guards;
+      const auto itrFind = std::find_if(config.FunctionGuards.begin(), config.FunctionGuards.end(),
+                                        [&function](const FunctionGuard& entry) { return entry.Name == function.Name; });
+      if (itrFind != config.FunctionGuards.end())
+        guards.push_back(itrFind->DefineContent);
+      if (config.VersionGuard.IsValid && function.Version != VersionRecord())
+        guards.push_back(config.VersionGuard.ToGuardString(function.Version));
+      return guards;
+    }
+
+
+    std::string AddGuards(const std::string& content, const std::deque<std::string>& guards)
+    {
+      if (guards.empty())
+        return content;
+
+      std::string newContent;
+      for (const auto& guard : guards)
+        newContent += END_OF_LINE + "#if " + guard;
+      newContent += content;
+      for (std::size_t i = 0; i < guards.size(); ++i)
+        newContent += END_OF_LINE + "#endif";
+      return newContent;
+    }
+
+
+    std::string GenerateParameterList(const FunctionRecord& function, const std::vector<std::string>& parameterNames)
+    {
+      std::string result;
+      for (std::size_t i = 0; i < function.Parameters.size(); ++i)
+      {
+        if (i > 0)
+          result += ", ";
+        result += DeclareVariable(function.Parameters[i].Type.FullTypeString.Get(), parameterNames[i]);
+      }
+      return result;
+    }
+
+
+    std::string GenerateHookMember(const FunctionRecord& function)
+    {
+      const auto parameterList = GenerateParameterList(function, GetParameterNames(function));
+      return fmt::format("{0}      {1} (*{2})({3}) = nullptr;", END_OF_LINE, function.ReturnType.FullTypeString.Get(), function.Name.Get(),
+                         parameterList);
+    }
+
+
+    std::string GenerateHandleLoop(const std::string& arrayName, const std::string& countExpression, const std::string& statement)
+    {
+      std::string content;
+      content += fmt::format("  if ({} != nullptr){}", arrayName, END_OF_LINE);
+      content += "  {" + END_OF_LINE;
+      content += fmt::format("    const auto stubCount = {};{}", countExpression, END_OF_LINE);
+      content += fmt::format("    for (std::size_t stubIndex = 0; stubIndex < static_cast<std::size_t>(stubCount); ++stubIndex){}", END_OF_LINE);
+      content += fmt::format("      {}{}", statement, END_OF_LINE);
+      content += "  }" + END_OF_LINE;
+      return content;
+    }
+
+
+    std::string GenerateCreateBody(const FunctionRecord& function, const StubFunction& stub, const std::vector<std::string>& parameterNames)
+    {
+      const auto acquire = fmt::format("ToHandle<{0}>(AcquireHandle(\"{0}\"))", stub.HandleTypeName);
+      switch (stub.Location)
+      {
+      case HandleLocation::Return:
+        return fmt::format("  return {};{}", acquire, END_OF_LINE);
+      case HandleLocation::Pointer:
+      {
+        const auto& name = parameterNames[stub.HandleParameterIndex];
+        return fmt::format("  if ({0} != nullptr){2}    *{0} = {1};{2}", name, acquire, END_OF_LINE);
+      }
+      case HandleLocation::Array:
+      {
+        const auto& name = parameterNames[stub.HandleParameterIndex];
+        return GenerateHandleLoop(name, stub.CountExpression, fmt::format("{}[stubIndex] = {};", name, acquire));
+      }
+      case HandleLocation::Value:
+      default:
+        throw NotSupportedException(std::string("Unsupported stub create handle location for ") + function.Name.Get());
+      }
+    }
+
+
+    std::string GenerateDestroyBody(const FunctionRecord& function, const StubFunction& stub, const std::vector<std::string>& parameterNames)
+    {
+      const auto& name = parameterNames[stub.HandleParameterIndex];
+      const auto release = [&stub, &function](const std::string& handle) {
+        return fmt::format("ReleaseHandle(\"{}\", \"{}\", FromHandle({}));", stub.HandleTypeName, function.Name.Get(), handle);
+      };
+      switch (stub.Location)
+      {
+      case HandleLocation::Value:
+        return "  " + release(name) + END_OF_LINE;
+      case HandleLocation::Pointer:
+      {
+        std::string content;
+        content += fmt::format("  if ({} != nullptr){}", name, END_OF_LINE);
+        content += "  {" + END_OF_LINE;
+        content += "    " + release("*" + name) + END_OF_LINE;
+        content += fmt::format("    *{} = ToHandle<{}>(0);{}", name, stub.HandleTypeName, END_OF_LINE);
+        content += "  }" + END_OF_LINE;
+        return content;
+      }
+      case HandleLocation::Array:
+        return GenerateHandleLoop(name, stub.CountExpression, release(name + "[stubIndex]"));
+      case HandleLocation::Return:
+      default:
+        throw NotSupportedException(std::string("Unsupported stub destroy handle location for ") + function.Name.Get());
+      }
+    }
+
+
+    //! @brief Check if the parameter is named like a element count
+    bool IsCountName(const std::string& name)
+    {
+      const auto lowerName = CaseUtil::LowerCase(name);
+      return lowerName == "n" || StringUtil::StartsWith(lowerName, "num") || lowerName.find("count") != std::string::npos ||
+             lowerName.find("size") != std::string::npos || lowerName.find("length") != std::string::npos;
+    }
+
+
+    //! @brief Check if the parameter is a output that the no-op entry point must initialize.
+    //!        A pointer that follows a count parameter is a array (the C API convention) and is left alone as its capacity is only known at
+    //!        runtime, the count output is initialized instead so the caller sees zero elements.
+    bool IsInitializedOutParameter(const FunctionRecord& function, const std::size_t index, const StubFunction& stub)
+    {
+      const auto& param = function.Parameters[index];
+      if (param.ParamType == ParameterType::ErrorCode || !param.Type.IsPointer || param.Type.IsConstQualified || param.Type.IsFunctionPointer)
+        return false;
+      // The handle is written or read by the body of the create/destroy function
+      if (stub.Role != StubRole::Other && index == stub.HandleParameterIndex)
+        return false;
+      // A void pointer or a pointer to a opaque type can't be assigned
+      if (param.Type.PointeeSizeOf <= 0)
+        return false;
+      return index == 0 || !IsCountName(function.Parameters[index - 1].Name.Get());
+    }
+
+
+    bool HasMember(const StructRecord& structRecord, const char* const pszName)
+    {
+      return std::any_of(structRecord.Members.begin(), structRecord.Members.end(),
+                         [pszName](const MemberRecord& member) { return member.Name == pszName; });
+    }
+
+
+    //! @brief Value initialize the output, the sType and pNext of a extensible struct are filled in by the caller so they are kept
+    std::string GenerateInitializeOutParameter(const Capture& capture, const ParameterRecord& param, const std::string& name)
+    {
+      const StructRecord* pStruct = param.Type.IsStruct ? capture.TryGetStruct(param.Type.Name.Get()) : nullptr;
+      if (pStruct == nullptr || !HasMember(*pStruct, "sType") || !HasMember(*pStruct, "pNext"))
+        return fmt::format("  if ({0} != nullptr){1}    *{0} = {{}};{1}", name, END_OF_LINE);
+
+      std::string content;
+      content += fmt::format("  if ({} != nullptr){}", name, END_OF_LINE);
+      content += "  {" + END_OF_LINE;
+      content += fmt::format("    const auto stubType = {}->sType;{}", name, END_OF_LINE);
+      content += fmt::format("    const auto stubNext = {}->pNext;{}", name, END_OF_LINE);
+      content += fmt::format("    *{} = {{}};{}", name, END_OF_LINE);
+      content += fmt::format("    {}->sType = stubType;{}", name, END_OF_LINE);
+      content += fmt::format("    {}->pNext = stubNext;{}", name, END_OF_LINE);
+      content += "  }" + END_OF_LINE;
+      return content;
+    }
+
+
+    std::string GenerateEntryPoint(const Capture& capture, const FunctionRecord& function, const StubFunction& stub)
+    {
+      const auto parameterNames = GetParameterNames(function);
+      const bool hasReturnValue = function.ReturnType.FullTypeString != "void";
+
+      std::string argumentList;
+      for (std::size_t i = 0; i < parameterNames.size(); ++i)
+        argumentList += (i > 0 ? ", " : "") + parameterNames[i];
+
+      std::string content = END_OF_LINE;
+      content += fmt::format("STUB_API_ENTRY {} STUB_API_CALL {}({}){}", function.ReturnType.FullTypeString.Get(), function.Name.Get(),
+                             GenerateParameterList(function, parameterNames), END_OF_LINE);
+      content += "{" + END_OF_LINE;
+      content += "  CountCall();" + END_OF_LINE;
+      content += fmt::format("  const auto stubHook = GetHook(&Hooks::{});{}", function.Name.Get(), END_OF_LINE);
+      content += "  if (stubHook != nullptr)" + END_OF_LINE;
+      content += fmt::format("    return stubHook({});{}", argumentList, END_OF_LINE);
+
+      for (std::size_t i = 0; i < function.Parameters.size(); ++i)
+      {
+        if (function.Parameters[i].ParamType == ParameterType::ErrorCode && function.Parameters[i].Type.IsPointer)
+          content += fmt::format("  if ({0} != nullptr){1}    *{0} = {{}};{1}", parameterNames[i], END_OF_LINE);
+        else if (IsInitializedOutParameter(function, i, stub))
+          content += GenerateInitializeOutParameter(capture, function.Parameters[i], parameterNames[i]);
+      }
+
+      switch (stub.Role)
+      {
+      case StubRole::Create:
+        content += GenerateCreateBody(function, stub, parameterNames);
+        break;
+      case StubRole::Destroy:
+        content += GenerateDestroyBody(function, stub, parameterNames);
+        break;
+      case StubRole::Other:
+      default:
+        break;
+      }
+
+      if (hasReturnValue && !(stub.Role == StubRole::Create && stub.Location == HandleLocation::Return))
+        content += "  return {};" + END_OF_LINE;
+      content += "}";
+      return content;
+    }
+
+
+    const TemplateSchema& GetStubTemplateSchema()
+    {
+      static const TemplateSchema schema = {"HOOKS",
+                                            "ENTRY_POINTS",
+                                            "API_NAME",
+                                            "API_VERSION",
+                                            "NAMESPACE_NAME",
+                                            "NAMESPACE_NAME!",
+                                            "AG_TOOL_STATEMENT"};
+      return schema;
+    }
+
+
+    CompiledTemplate LoadStubTemplate(const IO::Path& path)
+    {
+      return CompiledTemplate(path.ToUTF8String(), IO::File::ReadAllText(path), GetStubTemplateSchema());
+    }
+
+
+    //! @brief Render a stub template, the generated content and the tool statement must be used by it while the general values are optional
+    std::string ApplyTemplate(const CompiledTemplate& stubTemplate, const SimpleGeneratorConfig& config, const std::string& generatedKey,
+                              const std::string& generatedContent)
+    {
+      TemplateValues values(GetStubTemplateSchema());
+      values.Set(generatedKey, generatedContent);
+      values.SetOptional("API_NAME", config.APIName);
+      values.SetOptional("API_VERSION", config.APIVersion);
+      values.SetOptional("NAMESPACE_NAME", config.NamespaceName);
+      values.SetOptional("NAMESPACE_NAME!", CaseUtil::UpperCase(config.NamespaceName));
+      values.Set("AG_TOOL_STATEMENT", config.ToolStatement);
+      return stubTemplate.Render(values, UnusedTemplateValues::Error);
+    }
+  }
+
+
+  void StubBackendGenerator::Process(const Capture& capture, const SimpleGeneratorConfig& config, const FunctionAnalysis& functionAnalysis,
+                                     const IO::Path& templateRoot, const IO::Path& dstPath)
+  {
+    const auto pathTemplateDir = IO::Path::Combine(templateRoot, "stub");
+    if (!IO::Directory::Exists(pathTemplateDir))
+      return;
+
+    const auto headerTemplate = LoadStubTemplate(IO::Path::Combine(pathTemplateDir, "Template_header.hpp"));
+    const auto sourceTemplate = LoadStubTemplate(IO::Path::Combine(pathTemplateDir, "Template_source.cpp"));
+
+    const auto stubFunctions = AnalyzeFunctions(capture, config, functionAnalysis);
+    const StubFunction otherFunction;
+
+    std::string hooks;
+    std::string entryPoints;
+    for (const auto& function : capture.GetFunctions())
+    {
+      const auto itrFind = stubFunctions.find(function.Name.Get());
+      const StubFunction& stub = itrFind != stubFunctions.end() ? itrFind->second : otherFunction;
+      const auto guards = GetGuards(config, function);
+
+      hooks += AddGuards(GenerateHookMember(function), guards);
+      entryPoints += END_OF_LINE + AddGuards(GenerateEntryPoint(capture, function, stub), guards);
+    }
+
+    IOUtil::WriteAllTextIfChanged(IO::Path::Combine(dstPath, "Stub/StubBackend.hpp"), ApplyTemplate(headerTemplate, config, "HOOKS", hooks));
+    IOUtil::WriteAllTextIfChanged(IO::Path::Combine(dstPath, "Stub/StubBackend.cpp"),
+                                  ApplyTemplate(sourceTemplate, config, "ENTRY_POINTS", entryPoints));
+  }
+}
@@ -0,0 +1,102 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/HashUtil.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/PathDeque.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  uint64_t HashUtil::HashFileContent(const IO::Path& path)
+  {
+    std::vector<uint8_t> content;
+    IO::File::ReadAllBytes(content, path);
+    Fnv1aHasher hasher;
+    hasher.Add(static_cast<uint64_t>(content.size()));
+    hasher.Add(content.data(), content.size());
+    return hasher.GetHash();
+  }
+
+
+  uint64_t HashUtil::HashDirectoryContent(const IO::Path& path)
+  {
+    IO::PathDeque entries;
+    IO::Directory::GetFiles(entries, path, IO::SearchOptions::AllDirectories);
+
+    // The directory scan order is platform dependent
+    std::vector<std::string> files;
+    for (const auto& entry : entries)
+      files.push_back(entry->ToUTF8String());
+    std::sort(files.begin(), files.end());
+
+    Fnv1aHasher hasher;
+    hasher.Add(static_cast<uint64_t>(files.size()));
+    for (const auto& file : files)
+    {
+      hasher.Add(file);
+      hasher.Add(HashFileContent(IO::Path(file)));
+    }
+    return hasher.GetHash();
+  }
+
+
+  void HashUtil::AddCaptureConfig(Fnv1aHasher& rHasher, const CaptureConfig& captureConfig)
+  {
+    rHasher.Add(captureConfig.TypeNamePrefix);
+    rHasher.Add(static_cast<uint64_t>(captureConfig.Filters.size()));
+    for (const auto& filter : captureConfig.Filters)
+      rHasher.Add(filter);
+    rHasher.Add(static_cast<uint64_t>(captureConfig.FunctionParameterNameOverrides.size()));
+    for (const auto& entry : captureConfig.FunctionParameterNameOverrides)
+    {
+      rHasher.Add(entry.FunctionName);
+      rHasher.Add(static_cast<uint64_t>(entry.ParameterIndex));
+      rHasher.Add(entry.ParameterOldName);
+      rHasher.Add(entry.ParameterNewName);
+    }
+    rHasher.Add(static_cast<uint64_t>(captureConfig.FunctionParameterTypeOverrides.size()));
+    for (const auto& entry : captureConfig.FunctionParameterTypeOverrides)
+    {
+      rHasher.Add(entry.FunctionName);
+      rHasher.Add(static_cast<uint64_t>(entry.ParameterIndex));
+      rHasher.Add(entry.ParameterOldType);
+      rHasher.Add(entry.ParameterNewType);
+    }
+    rHasher.Add(static_cast<uint64_t>(captureConfig.OnlyScanMainHeaderFile ? 1 : 0));
+    AddParseConfig(rHasher, captureConfig.ParseConfig);
+  }
+
+
+  void HashUtil::AddParseConfig(Fnv1aHasher& rHasher, const ClangParseConfig& parseConfig)
+  {
+    rHasher.Add(static_cast<uint64_t>((parseConfig.SkipFunctionBodies ? 0x01 : 0) | (parseConfig.Incomplete ? 0x02 : 0) |
+                                      (parseConfig.SingleFileParse ? 0x04 : 0) | (parseConfig.KeepGoing ? 0x08 : 0)));
+    rHasher.Add(static_cast<uint64_t>(parseConfig.Defines.size()));
+    for (const auto& define : parseConfig.Defines)
+      rHasher.Add(define);
+  }
+}
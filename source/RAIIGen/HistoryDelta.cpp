@@ -0,0 +1,84 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/HistoryDelta.hpp>
+#include <RAIIGen/Capture.hpp>
+#include <algorithm>
+
+namespace MB
+{
+  namespace
+  {
+    std::vector<std::string> BuildAdded(const std::unordered_set<std::string>& previous, const std::unordered_set<std::string>& current)
+    {
+      std::vector<std::string> added;
+      for (const auto& name : current)
+      {
+        if (previous.find(name) == previous.end())
+          added.push_back(name);
+      }
+      std::sort(added.begin(), added.end());
+      return added;
+    }
+  }
+
+
+  HistorySnapshot::HistorySnapshot()
+  {
+  }
+
+
+  HistorySnapshot::HistorySnapshot(const Capture& capture)
+  {
+    for (const auto& entry : capture.GetStructDict())
+      Structs.insert(entry.first);
+
+    for (const auto& function : capture.GetFunctions())
+      Functions.insert(function.Name);
+
+    for (const auto& entry : capture.GetEnumDict())
+    {
+      Enums.insert(entry.first);
+
+      auto& rMembers = EnumMembers[entry.first];
+      for (const auto& member : entry.second.Members)
+        rMembers.insert(member.Name);
+    }
+  }
+
+
+  HistoryDelta::HistoryDelta(const HistorySnapshot& previous, const HistorySnapshot& current, const VersionRecord& version)
+    : Version(version)
+    , Structs(BuildAdded(previous.Structs, current.Structs))
+    , Functions(BuildAdded(previous.Functions, current.Functions))
+    , Enums(BuildAdded(previous.Enums, current.Enums))
+  {
+    const std::unordered_set<std::string> noMembers;
+    for (const auto& entry : current.EnumMembers)
+    {
+      const auto itrFind = previous.EnumMembers.find(entry.first);
+      auto added = BuildAdded(itrFind != previous.EnumMembers.end() ? itrFind->second : noMembers, entry.second);
+      if (!added.empty())
+        EnumMembers[entry.first] = std::move(added);
+    }
+  }
+}
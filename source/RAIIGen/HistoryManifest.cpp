@@ -0,0 +1,208 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/HistoryManifest.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const std::string MANIFEST_HEADER = "RAIIGenHistoryManifest";
+    //! Increase this whenever the manifest layout or the capture logic changes
+    const uint32_t MANIFEST_FORMAT_VERSION = 2;
+
+
+    std::string ToString(const VersionRecord& version)
+    {
+      return fmt::format("{} {} {} {}", version.Major, version.Minor, version.Build, version.Hotfix);
+    }
+
+
+    bool TryReadVersion(std::istringstream& rStream, VersionRecord& rVersion)
+    {
+      uint32_t major, minor, build, hotfix;
+      if (!(rStream >> major >> minor >> build >> hotfix))
+        return false;
+      rVersion = VersionRecord(major, minor, build, hotfix);
+      return true;
+    }
+
+
+    //! @brief Read the remainder of the line as the name, so names can contain spaces or be empty (anonymous records)
+    bool TryReadName(std::istringstream& rStream, std::string& rName)
+    {
+      if (rStream.get() != ' ')
+        return false;
+      rName.clear();
+      std::getline(rStream, rName);
+      return !rStream.bad();
+    }
+
+
+    //! @brief Read a name written as '<length> <name>', used when a line holds more than one name
+    bool TryReadLengthPrefixedName(std::istringstream& rStream, std::string& rName)
+    {
+      std::size_t length = 0;
+      if (!(rStream >> length) || rStream.get() != ' ')
+        return false;
+      rName.assign(length, '\0');
+      return length == 0 || static_cast<std::size_t>(rStream.read(&rName[0], static_cast<std::streamsize>(length)).gcount()) == length;
+    }
+
+
+    std::string ToLengthPrefixedName(const std::string& name)
+    {
+      return fmt::format("{} {}", name.size(), name);
+    }
+
+
+    //! The dictionaries are unordered so we sort the entries to produce a stable file
+    void AppendSorted(std::string& rContent, const std::string& tag, const std::unordered_map<std::string, VersionRecord>& dict,
+                      const std::string& prefix = std::string())
+    {
+      std::vector<const std::pair<const std::string, VersionRecord>*> entries;
+      entries.reserve(dict.size());
+      for (const auto& entry : dict)
+        entries.push_back(&entry);
+      std::sort(entries.begin(), entries.end(), [](const std::pair<const std::string, VersionRecord>* pLhs,
+                                                   const std::pair<const std::string, VersionRecord>* pRhs) { return pLhs->first < pRhs->first; });
+
+      // The name is written last so it can be read back as the remainder of the line
+      for (const auto pEntry : entries)
+      {
+        rContent += tag + " " + ToString(pEntry->second) + " " + prefix + pEntry->first + "\n";
+      }
+    }
+  }
+
+
+  HistoryManifest::HistoryManifest()
+    : ConfigHash(0)
+  {
+  }
+
+
+  HistoryManifest::HistoryManifest(const uint64_t configHash)
+    : ConfigHash(configHash)
+  {
+  }
+
+
+  bool HistoryManifest::TryLoad(HistoryManifest& rManifest, const IO::Path& path)
+  {
+    std::string content;
+    if (!IO::File::TryReadAllText(content, path))
+      return false;
+
+    std::istringstream contentStream(content);
+    std::string line;
+    if (!std::getline(contentStream, line) || line != fmt::format("{} {}", MANIFEST_HEADER, MANIFEST_FORMAT_VERSION))
+      return false;
+
+    HistoryManifest manifest;
+    while (std::getline(contentStream, line))
+    {
+      if (line.empty())
+        continue;
+
+      std::istringstream lineStream(line);
+      std::string tag;
+      lineStream >> tag;
+      if (tag == "ConfigHash")
+      {
+        if (!(lineStream >> std::hex >> manifest.ConfigHash))
+          return false;
+      }
+      else if (tag == "Version")
+      {
+        HistoryManifestEntry entry;
+        if (!(lineStream >> std::hex >> entry.ContentHash >> std::dec) || !TryReadName(lineStream, entry.Name))
+          return false;
+        manifest.Entries.push_back(entry);
+      }
+      else
+      {
+        VersionRecord version;
+        if (!TryReadVersion(lineStream, version))
+          return false;
+
+        std::string name;
+        if (tag == "EnumMember")
+        {
+          // The enum name is length prefixed and the member name is the remainder of the line
+          std::string memberName;
+          if (!TryReadLengthPrefixedName(lineStream, name) || !TryReadName(lineStream, memberName))
+            return false;
+          manifest.Index.AddEnumMember(name, memberName, version);
+        }
+        else if (!TryReadName(lineStream, name))
+          return false;
+        else if (tag == "Struct")
+          manifest.Index.AddStruct(name, version);
+        else if (tag == "Function")
+          manifest.Index.AddFunction(name, version);
+        else if (tag == "Enum")
+          manifest.Index.AddEnum(name, version);
+        else
+          return false;
+      }
+    }
+
+    rManifest = std::move(manifest);
+    return true;
+  }
+
+
+  void HistoryManifest::Save(const IO::Path& path) const
+  {
+    std::string content = fmt::format("{} {}\n", MANIFEST_HEADER, MANIFEST_FORMAT_VERSION);
+    content += fmt::format("ConfigHash {:016x}\n", ConfigHash);
+    for (const auto& entry : Entries)
+    {
+      content += fmt::format("Version {:016x} {}\n", entry.ContentHash, entry.Name);
+    }
+
+    AppendSorted(content, "Struct", Index.GetStructs());
+    AppendSorted(content, "Function", Index.GetFunctions());
+    AppendSorted(content, "Enum", Index.GetEnums());
+
+    std::vector<std::string> enumNames;
+    for (const auto& entry : Index.GetEnumMembers())
+      enumNames.push_back(entry.first);
+    std::sort(enumNames.begin(), enumNames.end());
+    for (const auto& enumName : enumNames)
+    {
+      AppendSorted(content, "EnumMember", Index.GetEnumMembers().find(enumName)->second, ToLengthPrefixedName(enumName) + " ");
+    }
+
+    IOUtil::WriteAllTextIfChanged(path, content);
+  }
+}
@@ -21,18 +21,170 @@
 //***************************************************************************************************************************************************
 
 #include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/AsyncFileWriter.hpp>
+#include <RAIIGen/OutputManifest.hpp>
+#include <FslBase/IO/Directory.hpp>
 #include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
 
 namespace MB
 {
   using namespace Fsl;
 
+  namespace
+  {
+    std::mutex g_registryMutex;
+    std::vector<std::shared_ptr<OutputManifest>> g_manifests;
+    std::shared_ptr<AsyncFileWriter> g_asyncFileWriter;
+    std::atomic<uint32_t> g_tempFileCounter(0);
+
+
+    std::shared_ptr<OutputManifest> TryFindManifest(const IO::Path& fileName)
+    {
+      std::lock_guard<std::mutex> lock(g_registryMutex);
+      for (const auto& manifest : g_manifests)
+      {
+        if (manifest->Contains(fileName))
+          return manifest;
+      }
+      return std::shared_ptr<OutputManifest>();
+    }
+
+
+    std::shared_ptr<AsyncFileWriter> TryGetAsyncFileWriter()
+    {
+      std::lock_guard<std::mutex> lock(g_registryMutex);
+      return g_asyncFileWriter;
+    }
+  }
+
+
   void IOUtil::WriteAllTextIfChanged(const IO::Path& fileName, const std::string& content)
   {
+    WriteAllTextIfChanged(fileName, std::string(content));
+  }
+
+
+  void IOUtil::WriteAllTextIfChanged(const IO::Path& fileName, std::string&& content)
+  {
+    const auto writer = TryGetAsyncFileWriter();
+    if (writer)
+    {
+      writer->Enqueue(fileName, std::move(content), TryFindManifest(fileName).get());
+      return;
+    }
+
+    const auto directoryName = IO::Path::GetDirectoryName(fileName);
+    if (!directoryName.IsEmpty())
+      IO::Directory::CreateDir(directoryName);
+    WriteAllTextIfChangedNow(fileName, content);
+  }
+
+
+  void IOUtil::WriteAllTextIfChangedNow(const IO::Path& fileName, const std::string& content)
+  {
+    const auto manifest = TryFindManifest(fileName);
+    if (manifest)
+    {
+      manifest->WriteAllTextIfChanged(fileName, content);
+      return;
+    }
+
     std::string currentContent;
     // Skip the write if the file already exist and if it contains the exact same content.
     if (IO::File::TryReadAllText(currentContent, fileName) && currentContent == content)
       return;
-    IO::File::WriteAllText(fileName, content);
+    WriteAllTextAtomic(fileName, content);
+  }
+
+
+  void IOUtil::WriteAllTextAtomic(const IO::Path& fileName, const std::string& content)
+  {
+    // The temporary file is placed next to the target so the move stays on the same volume
+    const IO::Path tempFileName(fmt::format("{}.{}.raiigen.tmp", fileName.ToUTF8String(), g_tempFileCounter++));
+    try
+    {
+      IO::File::WriteAllText(tempFileName, content);
+      IO::File::Move(tempFileName, fileName);
+    }
+    catch (const std::exception&)
+    {
+      IO::File::TryDelete(tempFileName);
+      throw;
+    }
+  }
+
+
+  void IOUtil::WriteAllBytesAtomic(const IO::Path& fileName, const std::vector<uint8_t>& content)
+  {
+    const IO::Path tempFileName(fmt::format("{}.{}.raiigen.tmp", fileName.ToUTF8String(), g_tempFileCounter++));
+    try
+    {
+      IO::File::WriteAllBytes(tempFileName, content);
+      IO::File::Move(tempFileName, fileName);
+    }
+    catch (const std::exception&)
+    {
+      IO::File::TryDelete(tempFileName);
+      throw;
+    }
+  }
+
+
+  void IOUtil::FlushWrites()
+  {
+    const auto writer = TryGetAsyncFileWriter();
+    if (writer)
+      writer->Join();
+  }
+
+
+  void IOUtil::FlushWrites(const std::shared_ptr<OutputManifest>& manifest)
+  {
+    const auto writer = TryGetAsyncFileWriter();
+    if (writer)
+      writer->Join(manifest.get());
+  }
+
+
+  void IOUtil::RegisterOutputManifest(const std::shared_ptr<OutputManifest>& manifest)
+  {
+    if (!manifest)
+      throw std::invalid_argument("manifest can not be null");
+
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    g_manifests.push_back(manifest);
+  }
+
+
+  void IOUtil::UnregisterOutputManifest(const std::shared_ptr<OutputManifest>& manifest)
+  {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    g_manifests.erase(std::remove(g_manifests.begin(), g_manifests.end(), manifest), g_manifests.end());
+  }
+
+
+  void IOUtil::RegisterAsyncFileWriter(const std::shared_ptr<AsyncFileWriter>& writer)
+  {
+    if (!writer)
+      throw std::invalid_argument("writer can not be null");
+
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    if (g_asyncFileWriter)
+      throw std::runtime_error("A async file writer is already registered");
+    g_asyncFileWriter = writer;
+  }
+
+
+  void IOUtil::UnregisterAsyncFileWriter(const std::shared_ptr<AsyncFileWriter>& writer)
+  {
+    std::lock_guard<std::mutex> lock(g_registryMutex);
+    if (g_asyncFileWriter == writer)
+      g_asyncFileWriter.reset();
   }
 }
@@ -0,0 +1,157 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/JobConsole.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <iostream>
+#include <memory>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    //! @brief Sends the output of threads bound to a job buffer to that buffer and everything else to the console.
+    //!        It's unbuffered so every write is routed using the thread that made it.
+    class JobConsoleStreamBuffer : public std::streambuf
+    {
+      std::streambuf* m_pConsole;
+      std::mutex m_consoleMutex;
+
+    public:
+      explicit JobConsoleStreamBuffer(std::streambuf* const pConsole)
+        : m_pConsole(pConsole)
+      {
+      }
+
+      std::streambuf* GetConsole() const
+      {
+        return m_pConsole;
+      }
+
+      void Write(const char* const pText, const std::size_t length)
+      {
+        auto pBuffer = JobConsole::GetThreadBuffer();
+        if (pBuffer != nullptr)
+          pBuffer->Append(pText, length);
+        else
+          WriteToConsole(pText, length);
+      }
+
+      void WriteToConsole(const char* const pText, const std::size_t length)
+      {
+        std::lock_guard<std::mutex> lock(m_consoleMutex);
+        m_pConsole->sputn(pText, static_cast<std::streamsize>(length));
+      }
+
+    protected:
+      int_type overflow(int_type ch) override
+      {
+        if (traits_type::eq_int_type(ch, traits_type::eof()))
+          return traits_type::not_eof(ch);
+        const char character = traits_type::to_char_type(ch);
+        Write(&character, 1);
+        return ch;
+      }
+
+      std::streamsize xsputn(const char* pText, std::streamsize count) override
+      {
+        if (count > 0)
+          Write(pText, static_cast<std::size_t>(count));
+        return count;
+      }
+
+      int sync() override
+      {
+        std::lock_guard<std::mutex> lock(m_consoleMutex);
+        return m_pConsole->pubsync();
+      }
+    };
+
+    std::unique_ptr<JobConsoleStreamBuffer> g_streamBuffer;
+
+    JobConsoleBuffer*& GetThreadBufferStorage()
+    {
+      static thread_local JobConsoleBuffer* pBuffer = nullptr;
+      return pBuffer;
+    }
+  }
+
+
+  void JobConsoleBuffer::Append(const char* const pText, const std::size_t length)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_text.append(pText, length);
+  }
+
+
+  std::string JobConsoleBuffer::Take()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string text;
+    std::swap(text, m_text);
+    return text;
+  }
+
+
+  void JobConsole::Redirect()
+  {
+    if (g_streamBuffer)
+      throw UsageErrorException("std::cout is already redirected");
+
+    std::cout.flush();
+    g_streamBuffer.reset(new JobConsoleStreamBuffer(std::cout.rdbuf()));
+    std::cout.rdbuf(g_streamBuffer.get());
+  }
+
+
+  void JobConsole::Restore()
+  {
+    if (!g_streamBuffer)
+      return;
+
+    std::cout.rdbuf(g_streamBuffer->GetConsole());
+    g_streamBuffer.reset();
+  }
+
+
+  JobConsoleBuffer* JobConsole::GetThreadBuffer()
+  {
+    return GetThreadBufferStorage();
+  }
+
+
+  void JobConsole::SetThreadBuffer(JobConsoleBuffer* const pBuffer)
+  {
+    GetThreadBufferStorage() = pBuffer;
+  }
+
+
+  void JobConsole::Write(const std::string& text)
+  {
+    if (g_streamBuffer)
+      g_streamBuffer->WriteToConsole(text.data(), text.size());
+    else
+      std::cout << text;
+  }
+}
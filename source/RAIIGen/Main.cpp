@@ -21,21 +21,43 @@
 //***************************************************************************************************************************************************
 
 #include <clang-c/Index.h>
+#include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
+#include <fmt/format.h>
 #include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
 #include <FslBase/IO/Path.hpp>
 #include <FslBase/IO/PathDeque.hpp>
+#include <FslBase/IO/PathWatcher.hpp>
 #include <FslBase/String/StringUtil.hpp>
 #include <RAIIGen/ProgramInfo.hpp>
+#include <RAIIGen/AsyncFileWriter.hpp>
+#include <RAIIGen/Benchmark/PipelineBenchmark.hpp>
+#include <RAIIGen/Benchmark/StringBenchmark.hpp>
 #include <RAIIGen/Capture.hpp>
+#include <RAIIGen/CaptureCache.hpp>
 #include <RAIIGen/CapturedData.hpp>
 #include <RAIIGen/CustomLogConsole.hpp>
+#include <RAIIGen/HashUtil.hpp>
+#include <RAIIGen/HistoryDelta.hpp>
+#include <RAIIGen/HistoryManifest.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <RAIIGen/JobConsole.hpp>
+#include <RAIIGen/OutputManifest.hpp>
+#include <RAIIGen/VersionIndex.hpp>
+#include <RAIIGen/ParallelUtil.hpp>
+#include <RAIIGen/Profiler.hpp>
 #include <RAIIGen/Generator/BasicConfig.hpp>
+#include <RAIIGen/Generator/Simple/SnippetStore.hpp>
 #include <RAIIGen/Generator/OpenCLGenerator.hpp>
 #include <RAIIGen/Generator/OpenGLESGenerator.hpp>
 #include <RAIIGen/Generator/OpenVXGenerator.hpp>
@@ -56,47 +78,110 @@ namespace MB
       IO::Path HeaderRoot;
       IO::Path TemplateRoot;
       IO::Path OutputRoot;
+      //! The number of threads used to capture the API history (0 = use the hardware concurrency)
+      uint32_t HistoryWorkerCount;
+      //! The directory used to cache the API history captures (empty = disabled)
+      IO::Path CaptureCachePath;
+      //! The directory used to cache the parsed translation units (empty = disabled)
+      IO::Path TranslationUnitCachePath;
+      //! The number of threads used to generate the code (0 = use the hardware concurrency)
+      uint32_t GeneratorWorkerCount;
+      //! The number of threads used to write the generated files (0 = use the default)
+      uint32_t WriterWorkerCount;
+      //! The number of jobs to run in parallel (0 = use the hardware concurrency)
+      uint32_t JobCount;
+      //! How often the inputs are checked for changes in watch mode
+      uint32_t WatchIntervalMilliseconds;
+      //! The file the profile is written to (empty = disabled)
+      IO::Path ProfilePath;
+      //! Write the struct layout report of each job to its output directory
+      bool WriteStructLayoutReport;
 
       Config()
+        : HistoryWorkerCount(0)
+        , GeneratorWorkerCount(0)
+        , WriterWorkerCount(0)
+        , JobCount(1)
+        , WatchIntervalMilliseconds(250)
+        , WriteStructLayoutReport(false)
       {
       }
 
 
-      Config(const IO::Path& headerRoot, const IO::Path& templateRoot, const IO::Path& outputRoot)
+      Config(const IO::Path& headerRoot, const IO::Path& templateRoot, const IO::Path& outputRoot, const uint32_t historyWorkerCount = 0,
+             const IO::Path& captureCachePath = IO::Path())
         : HeaderRoot(headerRoot)
         , TemplateRoot(templateRoot)
         , OutputRoot(outputRoot)
+        , HistoryWorkerCount(historyWorkerCount)
+        , CaptureCachePath(captureCachePath)
+        , GeneratorWorkerCount(0)
+        , WriterWorkerCount(0)
+        , JobCount(1)
+        , WatchIntervalMilliseconds(250)
+        , WriteStructLayoutReport(false)
       {
       }
     };
 
 
-    std::deque<std::shared_ptr<CapturedData>> RunCaptureHistory(const BasicConfig& basicConfig, const IO::Path& relativeFilename,
-                                                                const IO::Path& historyPath, const MB::CaptureConfig& captureConfig)
+    struct HistoryEntry
+    {
+      IO::Path Path;
+      std::string Name;
+      VersionRecord Version;
+
+      HistoryEntry(const IO::Path& path, const std::string& name, const VersionRecord& version)
+        : Path(path)
+        , Name(name)
+        , Version(version)
+      {
+      }
+    };
+
+
+    //! @brief The prefix of the history directories that belong to the API major version
+    std::string GetHistoryDirectoryPrefix(const std::string& apiVersion)
     {
-      using namespace MB;
       const bool useMajorVersion = true;
-      std::string sourceAPIVersion = basicConfig.APIVersion;
+      std::string sourceAPIVersion = apiVersion;
       if (useMajorVersion)
       {
         const auto dotIndex = StringUtil::IndexOf(sourceAPIVersion, '.');
         if (dotIndex >= 0)
           sourceAPIVersion = sourceAPIVersion.substr(0, dotIndex);
       }
+      return sourceAPIVersion + ".";
+    }
 
 
-      const std::string apiVersion = sourceAPIVersion + ".";
+    //! @brief Check if the history contains a directory that belongs to the API major version
+    bool HasHistory(const std::string& apiVersion, const IO::Path& historyPath)
+    {
+      IO::PathDeque entries;
+      if (!IO::Directory::TryGetDirectories(entries, historyPath, IO::SearchOptions::TopDirectoryOnly))
+        return false;
+
+      const std::string prefix = GetHistoryDirectoryPrefix(apiVersion);
+      return std::any_of(entries.begin(), entries.end(), [&prefix](const std::shared_ptr<IO::Path>& entry) {
+        return IO::Path::GetFileName(*entry).StartsWith(prefix);
+      });
+    }
+
+
+    //! @brief Locate the history directories that belong to the API major version, sorted from oldest to newest
+    std::deque<HistoryEntry> ScanHistory(const BasicConfig& basicConfig, const IO::Path& historyPath)
+    {
+      using namespace MB;
+      const std::string apiVersion = GetHistoryDirectoryPrefix(basicConfig.APIVersion);
 
-      std::deque<std::shared_ptr<CapturedData>> history;
+      std::deque<HistoryEntry> history;
 
       // Scan for history files
       IO::PathDeque entries;
       if (!IO::Directory::TryGetDirectories(entries, historyPath, IO::SearchOptions::TopDirectoryOnly))
         return history;
 
-      // For now we disable the logger during history parsing
-      const std::shared_ptr<CustomLog> customLog;
-
       std::cout << "Scanning API history"
                 << "\n";
       for (const auto& entry : entries)
@@ -105,283 +190,974 @@ namespace MB
         if (dirName.StartsWith(apiVersion))
         {
           std::cout << "- '" << dirName.ToUTF8String() << "'\n";
-
-          const auto srcFile = IO::Path::Combine(*entry, relativeFilename);
-
-          VersionRecord version(dirName.ToUTF8String());
-
-          // Create the history
-          std::vector<IO::Path> includePaths = {*entry};
-          history.push_back(std::make_shared<CapturedData>(basicConfig, srcFile, std::move(includePaths), captureConfig, customLog, version));
+          history.emplace_back(*entry, dirName.ToUTF8String(), VersionRecord(dirName.ToUTF8String()));
         }
       }
 
-      auto sortMethod = [](const std::shared_ptr<CapturedData>& lhs, const std::shared_ptr<CapturedData>& rhs) {
+      auto sortMethod = [](const HistoryEntry& lhs, const HistoryEntry& rhs) {
         const uint64_t domain = 1000000;
-        assert(lhs->Version.Major < domain);
-        assert(lhs->Version.Minor < domain);
-        assert(lhs->Version.Build < domain);
-        assert(rhs->Version.Major < domain);
-        assert(rhs->Version.Minor < domain);
-        assert(rhs->Version.Build < domain);
-        uint64_t lhsVal = static_cast<uint64_t>(lhs->Version.Major * 2 * domain) + static_cast<uint64_t>(lhs->Version.Minor * domain) +
-                          static_cast<uint64_t>(lhs->Version.Build);
-        uint64_t rhsVal = static_cast<uint64_t>(rhs->Version.Major * 2 * domain) + static_cast<uint64_t>(rhs->Version.Minor * domain) +
-                          static_cast<uint64_t>(rhs->Version.Build);
+        assert(lhs.Version.Major < domain);
+        assert(lhs.Version.Minor < domain);
+        assert(lhs.Version.Build < domain);
+        assert(rhs.Version.Major < domain);
+        assert(rhs.Version.Minor < domain);
+        assert(rhs.Version.Build < domain);
+        uint64_t lhsVal = static_cast<uint64_t>(lhs.Version.Major * 2 * domain) + static_cast<uint64_t>(lhs.Version.Minor * domain) +
+                          static_cast<uint64_t>(lhs.Version.Build);
+        uint64_t rhsVal = static_cast<uint64_t>(rhs.Version.Major * 2 * domain) + static_cast<uint64_t>(rhs.Version.Minor * domain) +
+                          static_cast<uint64_t>(rhs.Version.Build);
         return lhsVal < rhsVal;
       };
 
-      std::sort(history.begin(), history.end(), sortMethod);
+      std::stable_sort(history.begin(), history.end(), sortMethod);
+
+      // Always use 0.0.0 for the first version
+      if (!history.empty())
+        history.front().Version = VersionRecord();
       return history;
     }
 
 
-    std::shared_ptr<CapturedData> LocateFirstAppearanceOfStruct(const std::deque<std::shared_ptr<CapturedData>>& history, const std::string& name)
+    //! @brief Build the first appearance index for the history.
+    //!        The result is stored in a manifest, so a rerun only has to capture the history versions that were added since the last run.
+    VersionIndex BuildHistoryIndex(const BasicConfig& basicConfig, const IO::Path& relativeFilename, const std::deque<HistoryEntry>& history,
+                                   const MB::CaptureConfig& captureConfig, const IO::Path& manifestPath, const uint32_t workerCount,
+                                   const std::shared_ptr<CaptureCache>& captureCache)
     {
-      for (const auto& capture : history)
-      {
-        const auto structDict = capture->TheCapture.DirectAccessStructDict();
-        const auto itrFind = structDict.find(name);
-        if (itrFind != structDict.end())
-          return capture;
-      }
-
-      // This means that the file we are scanning is not part of the history, so its a user error
-      throw std::runtime_error("Could not be found in history");
-    }
+      ProfileScope profileScope("HistoryIndex");
+      Fnv1aHasher configHasher;
+      configHasher.Add(relativeFilename.ToUTF8String());
+      HashUtil::AddCaptureConfig(configHasher, captureConfig);
 
+      std::vector<uint64_t> contentHashes(history.size());
+      ParallelUtil::ForEachIndex(history.size(), workerCount,
+                                 [&](const std::size_t index) { contentHashes[index] = HashUtil::HashDirectoryContent(history[index].Path); });
 
-    std::shared_ptr<CapturedData> LocateFirstAppearanceOfFunction(const std::deque<std::shared_ptr<CapturedData>>& history, const std::string& name)
-    {
-      for (const auto& capture : history)
+      // The manifest can be reused if the versions it contains are a unmodified prefix of the current history
+      HistoryManifest manifest(configHasher.GetHash());
       {
-        const auto functions = capture->TheCapture.GetFunctions();
-        const auto itrFind = std::find_if(functions.begin(), functions.end(), [name](const FunctionRecord& val) { return val.Name == name; });
-        if (itrFind != functions.end())
-          return capture;
-      }
-
-      // This means that the file we are scanning is not part of the history, so its a user error
-      throw std::runtime_error("Could not be found in history");
-    }
-
-
-    std::shared_ptr<CapturedData> LocateFirstAppearanceOfEnum(const std::deque<std::shared_ptr<CapturedData>>& history, const std::string& name)
-    {
-      for (const auto& capture : history)
-      {
-        const auto enumDict = capture->TheCapture.GetEnumDict();
-
-        const auto itrFind = enumDict.find(name);
-        if (itrFind != enumDict.end())
-          return capture;
+        HistoryManifest existingManifest;
+        if (HistoryManifest::TryLoad(existingManifest, manifestPath) && existingManifest.ConfigHash == manifest.ConfigHash &&
+            existingManifest.Entries.size() <= history.size())
+        {
+          bool isPrefix = true;
+          for (std::size_t i = 0; i < existingManifest.Entries.size() && isPrefix; ++i)
+          {
+            isPrefix = existingManifest.Entries[i].Name == history[i].Name && existingManifest.Entries[i].ContentHash == contentHashes[i];
+          }
+          if (isPrefix)
+          {
+            manifest = std::move(existingManifest);
+            std::cout << "Reusing " << manifest.Entries.size() << " captured history versions from the manifest\n";
+          }
+        }
       }
 
-      // This means that the file we are scanning is not part of the history, so its a user error
-      throw std::runtime_error("Could not be found in history");
-    }
+      // For now we disable the logger during history parsing
+      const std::shared_ptr<CustomLog> customLog;
 
-    std::shared_ptr<CapturedData> LocateFirstAppearanceOfEnumMember(const std::deque<std::shared_ptr<CapturedData>>& history,
-                                                                    const std::string& enumName, const std::string& enumMemberName)
-    {
-      for (const auto& capture : history)
+      // Each CapturedData owns its own translation unit and concurrent parses borrow separate indices, so the entries can be parsed concurrently.
+      // A worker only keeps a compact snapshot of the captured symbols, so the capture and its translation unit are released as soon as the
+      // worker is done with it. The versions are captured in batches of one version per worker and each batch is added to the index in version
+      // order before the next one is captured, so only a batch of snapshots (and the previous one) is alive at any time and the result is
+      // deterministic.
+      const std::size_t firstNewIndex = manifest.Entries.size();
+      const std::size_t batchSize = ParallelUtil::GetWorkerCount(workerCount, history.size() - firstNewIndex);
+      std::vector<HistorySnapshot> snapshots;
+      // The versions that were restored from the manifest are already part of the index, so the first new version is compared against a empty
+      // snapshot. This is fine as the index never overwrites the first appearance of a symbol.
+      HistorySnapshot previousSnapshot;
+      for (std::size_t batchStart = firstNewIndex; batchStart < history.size(); batchStart += batchSize)
       {
-        const auto enumDict = capture->TheCapture.GetEnumDict();
+        snapshots.clear();
+        snapshots.resize(std::min(batchSize, history.size() - batchStart));
+        ParallelUtil::ForEachIndex(snapshots.size(), workerCount, [&](const std::size_t index) {
+          const auto& entry = history[batchStart + index];
+          const auto srcFile = IO::Path::Combine(entry.Path, relativeFilename);
 
-        const auto itrFind = enumDict.find(enumName);
-        if (itrFind != enumDict.end())
+          // Create the history
+          const std::vector<IO::Path> includePaths = {entry.Path};
+          std::shared_ptr<CapturedData> capturedData;
+          if (captureCache)
+            capturedData = captureCache->GetOrCapture(basicConfig, srcFile, includePaths, captureConfig, customLog, entry.Version);
+          else
+            capturedData = std::make_shared<CapturedData>(basicConfig, srcFile, includePaths, captureConfig, customLog, entry.Version);
+          snapshots[index] = HistorySnapshot(capturedData->TheCapture);
+        });
+
+        for (std::size_t i = 0; i < snapshots.size(); ++i)
         {
-          const auto& members = itrFind->second.Members;
-          const auto itrFindMember =
-            std::find_if(members.begin(), members.end(), [enumMemberName](const EnumMemberRecord& val) { return val.Name == enumMemberName; });
-          if (itrFindMember != members.end())
-            return capture;
+          manifest.Index.Add(HistoryDelta(previousSnapshot, snapshots[i], history[batchStart + i].Version));
+          manifest.Entries.emplace_back(history[batchStart + i].Name, contentHashes[batchStart + i]);
+          previousSnapshot = std::move(snapshots[i]);
         }
       }
 
-      // This means that the file we are scanning is not part of the history, so its a user error
-      throw std::runtime_error("Could not be found in history");
+      manifest.Save(manifestPath);
+      return manifest.Index;
     }
 
 
-    void TagStructsWithHistory(CapturedData& rCapturedData, const std::deque<std::shared_ptr<CapturedData>>& history)
+    void TagStructsWithHistory(CapturedData& rCapturedData, const VersionIndex& versionIndex)
     {
       for (auto& rEntry : rCapturedData.TheCapture.DirectAccessStructDict())
       {
-        const auto historyEntry = LocateFirstAppearanceOfStruct(history, rEntry.second.Name);
-        rEntry.second.Version = historyEntry->Version;
+        rEntry.second.Version = versionIndex.GetStructVersion(rEntry.second.Name);
       }
 
       for (auto& rEntry : rCapturedData.TheCapture.DirectAccessStructs())
       {
-        const auto historyEntry = LocateFirstAppearanceOfStruct(history, rEntry.Name);
-        rEntry.Version = historyEntry->Version;
+        rEntry.Version = versionIndex.GetStructVersion(rEntry.Name);
       }
     }
 
 
-    void TagFunctionsWithHistory(CapturedData& rCapturedData, const std::deque<std::shared_ptr<CapturedData>>& history)
+    void TagFunctionsWithHistory(CapturedData& rCapturedData, const VersionIndex& versionIndex)
     {
       for (auto& rEntry : rCapturedData.TheCapture.DirectAccessFunctions())
       {
-        const auto historyEntry = LocateFirstAppearanceOfFunction(history, rEntry.Name);
-        rEntry.Version = historyEntry->Version;
+        rEntry.Version = versionIndex.GetFunctionVersion(rEntry.Name);
       }
     }
 
 
-    void TagEnumsWithHistory(CapturedData& rCapturedData, const std::deque<std::shared_ptr<CapturedData>>& history)
+    void TagEnumsWithHistory(CapturedData& rCapturedData, const VersionIndex& versionIndex)
     {
       for (auto& rEntry : rCapturedData.TheCapture.DirectAccessEnumDict())
       {
-        const auto historyEntry = LocateFirstAppearanceOfEnum(history, rEntry.second.Name);
         // Tag the enum with the version it was introduced in
-        rEntry.second.Version = historyEntry->Version;
+        rEntry.second.Version = versionIndex.GetEnumVersion(rEntry.second.Name);
 
         for (auto& rEnumMember : rEntry.second.Members)
         {
           // Tag each individual enum member with the version it was introduced in.
-          const auto memberHistoryEntry = LocateFirstAppearanceOfEnumMember(history, rEntry.second.Name, rEnumMember.Name);
-          rEnumMember.Version = memberHistoryEntry->Version;
+          rEnumMember.Version = versionIndex.GetEnumMemberVersion(rEntry.second.Name, rEnumMember.Name);
         }
       }
     }
 
 
-    void TagWithHistory(CapturedData& rCapturedData, const std::deque<std::shared_ptr<CapturedData>>& history)
+    void TagWithHistory(CapturedData& rCapturedData, const VersionIndex& versionIndex)
     {
+      ProfileScope profileScope("HistoryTagging");
       std::cout << "- Enums\n";
-      TagEnumsWithHistory(rCapturedData, history);
+      TagEnumsWithHistory(rCapturedData, versionIndex);
       std::cout << "- Functions\n";
-      TagFunctionsWithHistory(rCapturedData, history);
+      TagFunctionsWithHistory(rCapturedData, versionIndex);
       std::cout << "- Structs\n";
-      TagStructsWithHistory(rCapturedData, history);
+      TagStructsWithHistory(rCapturedData, versionIndex);
     }
 
 
+    //! @brief Describes one template set that should be generated
+    struct GeneratorJob
+    {
+      using GetCaptureConfigFunction = CaptureConfig (*)();
+      using GenerateFunction = void (*)(const Capture&, const BasicConfig&, const IO::Path&, const IO::Path&);
+
+      std::string Filename;
+      std::string TemplateName;
+      std::string BaseApiName;
+      std::string ApiVersion;
+      bool UseAPIHistory;
+      //! Jobs that run when no jobs are selected on the command line
+      bool IsDefault;
+      GetCaptureConfigFunction GetCaptureConfig;
+      GenerateFunction Generate;
+
+      GeneratorJob(const std::string& filename, const std::string& templateName, const std::string& baseApiName, const std::string& apiVersion,
+                   const bool useAPIHistory, const bool isDefault, GetCaptureConfigFunction getCaptureConfig, GenerateFunction generate)
+        : Filename(filename)
+        , TemplateName(templateName)
+        , BaseApiName(baseApiName)
+        , ApiVersion(apiVersion)
+        , UseAPIHistory(useAPIHistory)
+        , IsDefault(isDefault)
+        , GetCaptureConfig(getCaptureConfig)
+        , Generate(generate)
+      {
+      }
+
+      std::string GetName() const
+      {
+        return TemplateName + ApiVersion;
+      }
+    };
+
+
     template <typename TGenerator>
-    void Run(const BasicConfig& basicConfig, const IO::Path& filename, const IO::Path& relativeFilename, const IO::Path& templatePath,
-             const IO::Path& apiHistoryPath, const IO::Path& dstPath, const std::vector<IO::Path>& includePaths, const bool useAPIHistory)
+    void Generate(const Capture& capture, const BasicConfig& basicConfig, const IO::Path& templatePath, const IO::Path& dstPath)
     {
-      using namespace MB;
+      TGenerator generator(capture, basicConfig, templatePath, dstPath);
+    }
 
-      // Ensure that the dst path exist
-      IO::Directory::CreateDir(dstPath);
 
-      const std::shared_ptr<CustomLog> customLog = std::make_shared<CustomLogConsole>();
+    template <typename TGenerator>
+    GeneratorJob MakeJob(const std::string& filename, const std::string& templateName, const std::string& baseApiName, const std::string& apiVersion,
+                         const bool useAPIHistory = false, const bool isDefault = false)
+    {
+      return GeneratorJob(filename, templateName, baseApiName, apiVersion, useAPIHistory, isDefault, &TGenerator::GetCaptureConfig,
+                          &Generate<TGenerator>);
+    }
 
-      const auto captureConfig = TGenerator::GetCaptureConfig();
 
-      std::deque<std::shared_ptr<CapturedData>> history;
-      BasicConfig currentConfig = basicConfig;
-      IO::Path fileToLoad = filename;
-      std::vector<IO::Path> finalIncludePaths(includePaths);
-      if (useAPIHistory)
+    //! @brief All the template sets we know how to generate
+    std::vector<GeneratorJob> GetKnownJobs()
+    {
+      return {
+        MakeJob<OpenCLGenerator>("CL/cl.h", "OpenCL", "OpenCL", "1", true),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "OpenCL", "OpenCL", "1.1"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "OpenCL", "OpenCL", "1.2"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "OpenCL", "OpenCL", "2.0"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "OpenCL", "OpenCL", "2.1"),
+        MakeJob<OpenVXGenerator>("VX/vx.h", "OpenVX", "OpenVX", "1.0.1"),
+        MakeJob<OpenVXGenerator>("VX/vx.h", "OpenVX", "OpenVX", "1.1"),
+        MakeJob<VulkanGenerator>("vulkan/vulkan.h", "Vulkan", "Vulkan", "1.0"),
+
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "1.1"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "1.2"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "2.0"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "2.1"),
+        // RapidOpenCL1, the current release is based on OpenCL1.2
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "1", true),
+        // RapidOpenCL2
+        MakeJob<OpenCLGenerator>("CL/cl.h", "RapidOpenCL", "OpenCL", "2", true),
+        // RapidOpenVX
+        MakeJob<OpenVXGenerator>("VX/vx.h", "RapidOpenVX", "OpenVX", "1.0.1", true),
+        MakeJob<OpenVXGenerator>("VX/vx.h", "RapidOpenVX", "OpenVX", "1.1", true),
+        // RapidVulkan
+        MakeJob<VulkanGenerator>("vulkan/vulkan.h", "RapidVulkan", "Vulkan", "1.0", true, true),
+        MakeJob<VulkanGenerator>("vulkan/vulkan.h", "RapidVulkan", "Vulkan", "1.1", true),
+
+        MakeJob<OpenCLGenerator>("CL/cl.h", "FslUtilOpenCL", "OpenCL", "1.1"),
+        MakeJob<OpenCLGenerator>("CL/cl.h", "FslUtilOpenCL", "OpenCL", "1.2"),
+        MakeJob<OpenVXGenerator>("VX/vx.h", "FslUtilOpenVX", "OpenVX", "1.0.1"),
+        MakeJob<OpenVXGenerator>("VX/vx.h", "FslUtilOpenVX", "OpenVX", "1.1"),
+        MakeJob<VulkanGenerator>("vulkan/vulkan.h", "FslUtil.Vulkan", "Vulkan", "1.0"),
+
+        MakeJob<OpenGLESGenerator>("GLES2/gl2.h", "RapidOpenGLES", "OpenGLES", "2.0"),
+        MakeJob<OpenGLESGenerator>("GLES3/gl3.h", "RapidOpenGLES", "OpenGLES", "3.0"),
+        MakeJob<OpenGLESGenerator>("GLES3/gl31.h", "RapidOpenGLES", "OpenGLES", "3.1"),
+        MakeJob<OpenGLESGenerator>("GLES3/gl32.h", "RapidOpenGLES", "OpenGLES", "3.2"),
+      };
+    }
+
+
+    //! @brief A job with all its paths and settings resolved
+    struct ResolvedJob
+    {
+      const GeneratorJob* pJob;
+      IO::Path SrcFile;
+      IO::Path TemplatePath;
+      IO::Path DstPath;
+      IO::Path ApiHistoryPath;
+      std::vector<IO::Path> IncludePaths;
+      BasicConfig TheBasicConfig;
+      CaptureConfig TheCaptureConfig;
+      //! Jobs with the same key can share the same capture
+      std::string CaptureKey;
+
+      ResolvedJob(const ProgramInfo& programInfo, const Config& config, const GeneratorJob& job)
+        : pJob(&job)
+        , TheCaptureConfig(job.GetCaptureConfig())
+      {
+        const auto apiVersion = VersionRecord(job.ApiVersion, true);
+        const auto apiNameAndVersion = job.BaseApiName + job.ApiVersion;
+        const auto apiHeaderPath = IO::Path::Combine(config.HeaderRoot, IO::Path::Combine("khronos", apiNameAndVersion));
+        SrcFile = IO::Path::Combine(apiHeaderPath, job.Filename);
+        TemplatePath = IO::Path::Combine(config.TemplateRoot, job.TemplateName);
+        DstPath = IO::Path::Combine(config.OutputRoot, job.GetName());
+        ApiHistoryPath = IO::Path::Combine(apiHeaderPath, "history");
+        IncludePaths = {apiHeaderPath};
+
+        const auto toolStatement = std::string("Auto-generated ") + job.BaseApiName + " " + job.ApiVersion + " C++11 RAII classes by " +
+                                   programInfo.Name + " (https://github.com/Unarmed1000/RAIIGen)";
+
+        auto namespaceName = job.GetName();
+        StringUtil::Replace(namespaceName, ".", "_");
+
+        TheBasicConfig = BasicConfig(programInfo, toolStatement, namespaceName, job.BaseApiName, job.ApiVersion, apiVersion);
+        TheBasicConfig.WorkerCount = config.GeneratorWorkerCount;
+        TheBasicConfig.TranslationUnitCachePath = config.TranslationUnitCachePath;
+        TheBasicConfig.WriteStructLayoutReport = config.WriteStructLayoutReport;
+
+        // The header, the history usage and the capture settings decide the capture, the template set only affects the generation
+        Fnv1aHasher captureConfigHasher;
+        HashUtil::AddCaptureConfig(captureConfigHasher, TheCaptureConfig);
+        CaptureKey = fmt::format("{}|{}|{:016x}", SrcFile.ToUTF8String(), job.UseAPIHistory ? 1 : 0, captureConfigHasher.GetHash());
+      }
+
+      //! @brief Check that the header and the template set used by the job exist
+      //! @return a description of what is missing or a empty string if the job can run
+      std::string GetUnavailableReason() const
+      {
+        if (!IO::Directory::Exists(TemplatePath))
+          return fmt::format("the template directory '{}' does not exist", TemplatePath.ToUTF8String());
+        // A job using the API history captures the latest history entry instead of the header
+        if (!IO::File::Exists(SrcFile) && !(pJob->UseAPIHistory && HasHistory(pJob->ApiVersion, ApiHistoryPath)))
+          return fmt::format("the header '{}' does not exist", SrcFile.ToUTF8String());
+        return std::string();
+      }
+    };
+
+
+    //! @brief The result of capturing a header, shared by all jobs that use it
+    struct SharedCapture
+    {
+      std::unique_ptr<CapturedData> Data;
+      //! The full path of the header and every file it included
+      std::vector<IO::Path> InputFiles;
+      //! Set if the capture was made from the latest API history entry
+      bool HasHistoryAPIVersion;
+      VersionRecord HistoryAPIVersion;
+
+      SharedCapture()
+        : HasHistoryAPIVersion(false)
+      {
+      }
+    };
+
+
+    //! @brief Capture the header used by the job (and tag it using the API history if requested)
+    std::unique_ptr<SharedCapture> CaptureAPI(const ResolvedJob& resolvedJob, const uint32_t historyWorkerCount,
+                                              const std::shared_ptr<CaptureCache>& captureCache)
+    {
+      const GeneratorJob& job = *resolvedJob.pJob;
+      ScopedProfileJob profileJob(job.GetName());
+      ProfileScope profileScope("Capture");
+      std::cout << "*** Capturing " << resolvedJob.SrcFile.ToUTF8String() << " ***\n";
+
+      std::unique_ptr<SharedCapture> result(new SharedCapture());
+      const std::shared_ptr<CustomLog> customLog = std::make_shared<CustomLogConsole>();
+
+      std::unique_ptr<VersionIndex> versionIndex;
+      IO::Path fileToLoad = resolvedJob.SrcFile;
+      std::vector<IO::Path> finalIncludePaths(resolvedJob.IncludePaths);
+      if (job.UseAPIHistory)
       {
-        history = RunCaptureHistory(basicConfig, relativeFilename, apiHistoryPath, captureConfig);
+        const auto history = ScanHistory(resolvedJob.TheBasicConfig, resolvedJob.ApiHistoryPath);
         if (!history.empty())
         {
+          // The history manifest is kept in the destination of the first job that uses the capture
+          IO::Directory::CreateDir(resolvedJob.DstPath);
+          const auto manifestPath = IO::Path::Combine(resolvedJob.DstPath, "RAIIGenHistoryManifest.txt");
+          versionIndex.reset(new VersionIndex(BuildHistoryIndex(resolvedJob.TheBasicConfig, job.Filename, history, resolvedJob.TheCaptureConfig,
+                                                                manifestPath, historyWorkerCount, captureCache)));
+
           std::cout << "Version tagging elements using history\n";
-          // Always use 0.0.0 for the first version
-          history.front()->Version = VersionRecord();
           // use the latest version from history
-          fileToLoad = history.back()->FileData.Filename;
+          fileToLoad = IO::Path::Combine(history.back().Path, job.Filename);
           // Override the include path
-          finalIncludePaths = history.back()->FileData.IncludePaths;
-          currentConfig.CurrentAPIVersion = history.back()->Version;
+          finalIncludePaths = {history.back().Path};
+          result->HasHistoryAPIVersion = true;
+          result->HistoryAPIVersion = history.back().Version;
         }
       }
 
       VersionRecord version;
-      CapturedData capturedData(currentConfig, fileToLoad, finalIncludePaths, captureConfig, customLog, version);
+      result->Data.reset(
+        new CapturedData(resolvedJob.TheBasicConfig, fileToLoad, finalIncludePaths, resolvedJob.TheCaptureConfig, customLog, version));
 
-      if (useAPIHistory && !history.empty())
+      if (versionIndex)
       {
-        TagWithHistory(capturedData, history);
+        TagWithHistory(*result->Data, *versionIndex);
       }
 
-      // captureConfig.GetCapture().Dump();
-      TGenerator generator(capturedData.TheCapture, currentConfig, templatePath, dstPath);
+      if (result->Data->FileData)
+      {
+        for (const auto& file : result->Data->FileData->GetIncludedFiles())
+          result->InputFiles.push_back(IO::Path::GetFullPath(file));
+      }
+      else
+      {
+        result->InputFiles.push_back(IO::Path::GetFullPath(result->Data->Filename));
+      }
+      return result;
     }
 
 
-    template <typename TGenerator>
-    void RunGenerator(const ProgramInfo& programInfo, const Config& config, const std::string& filename, const std::string& templateName,
-                      const std::string& baseApiName, const std::string& strApiVersion, const bool useAPIHistory = false)
+    void RunJob(const ResolvedJob& resolvedJob, const SharedCapture& sharedCapture)
+    {
+      ScopedProfileJob profileJob(resolvedJob.pJob->GetName());
+      ProfileScope profileScope("Job");
+      std::cout << "*** Running " << resolvedJob.pJob->GetName() << " generator ***\n";
+
+      BasicConfig currentConfig = resolvedJob.TheBasicConfig;
+      if (sharedCapture.HasHistoryAPIVersion)
+        currentConfig.CurrentAPIVersion = sharedCapture.HistoryAPIVersion;
+
+      // Ensure that the dst path exist
+      IO::Directory::CreateDir(resolvedJob.DstPath);
+
+      // Route all writes below the dst path through the output manifest so unchanged files can be skipped without reading them
+      const auto outputManifest = std::make_shared<OutputManifest>(resolvedJob.DstPath);
+      ScopedOutputManifest scopedOutputManifest(outputManifest);
+
+      resolvedJob.pJob->Generate(sharedCapture.Data->TheCapture, currentConfig, resolvedJob.TemplatePath, resolvedJob.DstPath);
+
+      // The manifest can only be saved once all the files it records have been written
+      {
+        ProfileScope flushProfileScope("FlushWrites");
+        // Only this jobs writes are waited for, so parallel jobs don't wait on each other
+        IOUtil::FlushWrites(outputManifest);
+        outputManifest->Save();
+      }
+      Profiler::AddMemorySample();
+    }
+
+
+    //! @brief The resolved jobs grouped by the capture they use
+    struct JobGraph
+    {
+      std::vector<ResolvedJob> Jobs;
+      //! The index of the first job that uses each capture, that job is used to make the capture
+      std::vector<std::size_t> CaptureJobIndex;
+      //! The capture used by each job
+      std::vector<std::size_t> JobCaptureIndex;
+      std::vector<std::unique_ptr<SharedCapture>> Captures;
+      std::shared_ptr<CaptureCache> TheCaptureCache;
+    };
+
+
+    //! @brief Resolve the jobs and group them so every header is only captured once.
+    //!        Jobs whose header or template set doesn't exist are skipped with a warning.
+    void BuildJobGraph(JobGraph& rGraph, const ProgramInfo& programInfo, const Config& config, const std::vector<const GeneratorJob*>& jobs)
+    {
+      rGraph.Jobs.reserve(jobs.size());
+      for (const auto pJob : jobs)
+      {
+        rGraph.Jobs.emplace_back(programInfo, config, *pJob);
+        const auto unavailableReason = rGraph.Jobs.back().GetUnavailableReason();
+        if (!unavailableReason.empty())
+        {
+          std::cout << "WARNING: Skipping job '" << pJob->GetName() << "' as " << unavailableReason << "\n";
+          rGraph.Jobs.pop_back();
+        }
+      }
+
+      std::unordered_map<std::string, std::size_t> captureIndexByKey;
+      rGraph.JobCaptureIndex.resize(rGraph.Jobs.size());
+      for (std::size_t i = 0; i < rGraph.Jobs.size(); ++i)
+      {
+        const auto itrFind = captureIndexByKey.find(rGraph.Jobs[i].CaptureKey);
+        if (itrFind != captureIndexByKey.end())
+        {
+          rGraph.JobCaptureIndex[i] = itrFind->second;
+        }
+        else
+        {
+          rGraph.JobCaptureIndex[i] = rGraph.CaptureJobIndex.size();
+          captureIndexByKey.emplace(rGraph.Jobs[i].CaptureKey, rGraph.CaptureJobIndex.size());
+          rGraph.CaptureJobIndex.push_back(i);
+        }
+      }
+      rGraph.Captures.resize(rGraph.CaptureJobIndex.size());
+
+      if (!config.CaptureCachePath.IsEmpty())
+        rGraph.TheCaptureCache = std::make_shared<CaptureCache>(config.CaptureCachePath);
+    }
+
+
+    //! @brief Make the given captures in parallel, the console output of each capture is printed in one go once it's done
+    void CaptureJobs(JobGraph& rGraph, const Config& config, const std::vector<std::size_t>& captureIndices)
+    {
+      ParallelUtil::ForEachIndex(captureIndices.size(), config.JobCount, [&](const std::size_t index) {
+        ScopedJobConsoleBuffer consoleBuffer;
+        const auto captureIndex = captureIndices[index];
+        rGraph.Captures[captureIndex] =
+          CaptureAPI(rGraph.Jobs[rGraph.CaptureJobIndex[captureIndex]], config.HistoryWorkerCount, rGraph.TheCaptureCache);
+      });
+    }
+
+
+    //! @brief Run the given jobs in parallel, the captures they use must exist.
+    //!        The console output of each job is printed in one go once it's done.
+    void RunJobs(const JobGraph& graph, const Config& config, const std::vector<std::size_t>& jobIndices)
+    {
+      ParallelUtil::ForEachIndex(jobIndices.size(), config.JobCount, [&](const std::size_t index) {
+        ScopedJobConsoleBuffer consoleBuffer;
+        const auto jobIndex = jobIndices[index];
+        RunJob(graph.Jobs[jobIndex], *graph.Captures[graph.JobCaptureIndex[jobIndex]]);
+      });
+    }
+
+
+    std::vector<std::size_t> GetAllIndices(const std::size_t count)
     {
-      const auto apiVersion = VersionRecord(strApiVersion, true);
-      const auto apiNameAndVersion = baseApiName + strApiVersion;
-      const auto templateNameAndVersion = templateName + strApiVersion;
-      const auto apiHeaderPath = IO::Path::Combine(config.HeaderRoot, IO::Path::Combine("khronos", apiNameAndVersion));
-      const auto templatePath = IO::Path::Combine(config.TemplateRoot, templateName);
-      const auto srcFile = IO::Path::Combine(apiHeaderPath, filename);
-      const auto dstPath = IO::Path::Combine(config.OutputRoot, templateNameAndVersion);
-      const auto apiHistoryPath = IO::Path::Combine(apiHeaderPath, "history");
+      std::vector<std::size_t> indices(count);
+      for (std::size_t i = 0; i < count; ++i)
+        indices[i] = i;
+      return indices;
+    }
 
-      const std::vector<IO::Path> includePaths = {apiHeaderPath};
-      std::cout << "*** Running " << apiNameAndVersion << " generator ***\n";
 
+    //! @brief Split the hardware threads between the jobs that run in parallel so their worker pools don't oversubscribe the cpu.
+    //! @return the number of jobs that will run in parallel
+    std::size_t DivideWorkersBetweenJobs(Config& rConfig, const std::size_t jobCount)
+    {
+      const auto parallelJobCount = ParallelUtil::GetWorkerCount(rConfig.JobCount, jobCount);
+      if (parallelJobCount <= 1)
+        return parallelJobCount;
+
+      const auto threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+      const auto workersPerJob = static_cast<uint32_t>(std::max(threadCount / parallelJobCount, std::size_t(1)));
+      // Only the worker counts that were left to the hardware concurrency are divided
+      if (rConfig.HistoryWorkerCount == 0)
+        rConfig.HistoryWorkerCount = workersPerJob;
+      if (rConfig.GeneratorWorkerCount == 0)
+        rConfig.GeneratorWorkerCount = workersPerJob;
+      return parallelJobCount;
+    }
 
-      const auto toolStatement = std::string("Auto-generated ") + baseApiName + " " + strApiVersion + " C++11 RAII classes by " + programInfo.Name +
-                                 " (https://github.com/Unarmed1000/RAIIGen)";
 
-      auto namespaceName = templateName + strApiVersion;
-      StringUtil::Replace(namespaceName, ".", "_");
+    //! @brief Run all jobs, the captures are made in parallel and once they are all done the jobs are run in parallel.
+    void RunAllJobs(JobGraph& rGraph, const Config& config)
+    {
+      std::cout << "Running " << rGraph.Jobs.size() << " job(s) using " << rGraph.CaptureJobIndex.size() << " capture(s)\n";
+      CaptureJobs(rGraph, config, GetAllIndices(rGraph.CaptureJobIndex.size()));
+      RunJobs(rGraph, config, GetAllIndices(rGraph.Jobs.size()));
+    }
 
-      BasicConfig basicConfig(programInfo, toolStatement, namespaceName, baseApiName, strApiVersion, apiVersion);
 
-      Run<TGenerator>(basicConfig, srcFile, filename, templatePath, apiHistoryPath, dstPath, includePaths, useAPIHistory);
+    void WriteProfile(const Config& config)
+    {
+      if (config.ProfilePath.IsEmpty())
+        return;
+      Profiler::WriteSummary(std::cout);
+      Profiler::WriteChromeTrace(config.ProfilePath);
+      std::cout << "Profile written to '" << config.ProfilePath.ToUTF8String() << "'\n";
     }
 
 
-    void GenerateClasses(const ProgramInfo& programInfo, const IO::Path& currentWorkingDirectory)
+    //! @brief Check if the path is the root or below it, the parents are compared as paths so only whole directory names match
+    bool IsPathBelow(const IO::Path& path, const IO::Path& root)
+    {
+      IO::Path current(path);
+      while (!current.IsEmpty())
+      {
+        if (current == root)
+          return true;
+        current = IO::Path::GetDirectoryName(current);
+      }
+      return false;
+    }
+
+
+    //! @brief Watch the captured headers, the files they include and every file and directory below the template roots.
+    //!        The paths that are already watched keep their state, so calling this again only starts watching the new paths.
+    void WatchJobInputs(IO::PathWatcher& rWatcher, const JobGraph& graph)
+    {
+      for (const auto& capture : graph.Captures)
+      {
+        for (const auto& file : capture->InputFiles)
+          rWatcher.TryAdd(file);
+      }
+
+      for (const auto& job : graph.Jobs)
+      {
+        rWatcher.TryAdd(job.TemplatePath);
+        IO::PathDeque paths;
+        // Directories are watched as well so we notice files being added or removed
+        if (IO::Directory::TryGetDirectories(paths, job.TemplatePath, IO::SearchOptions::AllDirectories))
+        {
+          for (const auto& path : paths)
+            rWatcher.TryAdd(*path);
+        }
+        if (IO::Directory::TryGetFiles(paths, job.TemplatePath, IO::SearchOptions::AllDirectories))
+        {
+          for (const auto& path : paths)
+            rWatcher.TryAdd(*path);
+        }
+      }
+    }
+
+
+    //! @brief Keep the captures in memory and regenerate the jobs affected by changes to their headers or template files.
+    //!        A changed header (or a file it includes) is captured again and all the jobs that use it are rerun, a changed template file only
+    //!        reruns the jobs using that template set. The output manifest ensures that only the outputs that actually changed are written.
+    //! @note  The analysis of a job is not cached, so a rerun job is analyzed again from its (possibly cached) capture.
+    void WatchJobs(JobGraph& rGraph, const Config& config)
+    {
+      // The watcher lives for the whole session, so a file saved while a regeneration runs is still reported by the next check
+      IO::PathWatcher watcher;
+      WatchJobInputs(watcher, rGraph);
+      std::cout << "Watching for changes (press Ctrl+C to exit)\n";
+
+      std::deque<IO::Path> checkedPaths;
+      std::deque<IO::Path> changedPaths;
+      while (true)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(config.WatchIntervalMilliseconds));
+        if (!watcher.Check(changedPaths))
+          continue;
+
+        // Saving often touches several files in a row, so keep collecting until a check comes back quiet and regenerate once
+        do
+        {
+          std::this_thread::sleep_for(std::chrono::milliseconds(config.WatchIntervalMilliseconds));
+          watcher.Check(checkedPaths);
+          for (const auto& checkedPath : checkedPaths)
+          {
+            if (std::find(changedPaths.begin(), changedPaths.end(), checkedPath) == changedPaths.end())
+              changedPaths.push_back(checkedPath);
+          }
+        } while (!checkedPaths.empty());
+
+        std::vector<bool> isCaptureAffected(rGraph.Captures.size(), false);
+        std::vector<bool> isJobAffected(rGraph.Jobs.size(), false);
+        for (const auto& changedPath : changedPaths)
+        {
+          std::cout << "Changed: " << changedPath.ToUTF8String() << "\n";
+          for (std::size_t i = 0; i < rGraph.Captures.size(); ++i)
+          {
+            const auto& inputFiles = rGraph.Captures[i]->InputFiles;
+            if (std::find(inputFiles.begin(), inputFiles.end(), changedPath) != inputFiles.end())
+              isCaptureAffected[i] = true;
+          }
+          for (std::size_t i = 0; i < rGraph.Jobs.size(); ++i)
+          {
+            if (isCaptureAffected[rGraph.JobCaptureIndex[i]] || IsPathBelow(changedPath, rGraph.Jobs[i].TemplatePath))
+              isJobAffected[i] = true;
+          }
+        }
+
+        std::vector<std::size_t> captureIndices;
+        for (std::size_t i = 0; i < isCaptureAffected.size(); ++i)
+        {
+          if (isCaptureAffected[i])
+            captureIndices.push_back(i);
+        }
+        std::vector<std::size_t> jobIndices;
+        for (std::size_t i = 0; i < isJobAffected.size(); ++i)
+        {
+          if (isJobAffected[i])
+            jobIndices.push_back(i);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        try
+        {
+          // The snippets are cached per template root, so drop them to pick up the changes
+          SnippetStore::ClearCache();
+          // Each regeneration gets its own profile
+          Profiler::Clear();
+          CaptureJobs(rGraph, config, captureIndices);
+          RunJobs(rGraph, config, jobIndices);
+          const auto end = std::chrono::steady_clock::now();
+          std::cout << "Regenerated " << jobIndices.size() << " job(s) in " << std::chrono::duration<double, std::milli>(end - start).count()
+                    << "ms\n";
+          WriteProfile(config);
+        }
+        catch (const std::exception& ex)
+        {
+          // A broken template is a normal part of editing it, so we report the error and keep watching
+          std::cout << "ERROR: " << ex.what() << "\n";
+        }
+
+        // The captures might include new files and template files might have been added, so start watching those as well
+        WatchJobInputs(watcher, rGraph);
+      }
+    }
+
+
+    //! @brief Delete the directory and everything below it, anything that can't be deleted is left behind
+    void TryDeleteDirectoryTree(const IO::Path& path)
+    {
+      IO::PathDeque files;
+      if (IO::Directory::TryGetFiles(files, path, IO::SearchOptions::AllDirectories))
+      {
+        for (const auto& pFile : files)
+          IO::File::TryDelete(*pFile);
+      }
+
+      // A directory path is always longer than the path of its parent, so deleting the longest paths first empties the children first
+      IO::PathDeque directories;
+      if (IO::Directory::TryGetDirectories(directories, path, IO::SearchOptions::AllDirectories))
+      {
+        std::vector<IO::Path> sortedDirectories;
+        for (const auto& pDirectory : directories)
+          sortedDirectories.push_back(*pDirectory);
+        std::sort(sortedDirectories.begin(), sortedDirectories.end(),
+                  [](const IO::Path& lhs, const IO::Path& rhs) { return lhs.GetByteSize() > rhs.GetByteSize(); });
+        for (const auto& directory : sortedDirectories)
+          IO::Directory::TryDelete(directory);
+      }
+      IO::Directory::TryDelete(path);
+    }
+
+
+    //! @brief A directory below the system temp directory that is unique for this run
+    IO::Path GetBenchmarkOutputRoot()
+    {
+#ifdef _WIN32
+      const char* const pszTempDir = std::getenv("TEMP");
+#else
+      const char* const pszTempDir = std::getenv("TMPDIR");
+#endif
+      const IO::Path tempDir(pszTempDir != nullptr && pszTempDir[0] != 0 ? pszTempDir : "/tmp");
+      const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+      return IO::Path::Combine(tempDir, fmt::format("RAIIGenBenchmark-{}", timestamp));
+    }
+
+
+    //! @brief Run the capture, history tagging, analysis and generation of the benchmark jobs end-to-end the requested number of times.
+    //!        Every iteration writes to a fresh directory and the capture cache is disabled so no run benefits from the work of a previous one.
+    void RunPipelineBenchmark(const ProgramInfo& programInfo, const IO::Path& currentWorkingDirectory, const uint32_t iterationCount,
+                              const uint32_t historyWorkerCount)
+    {
+      const auto headerRoot = IO::Path::Combine(currentWorkingDirectory, "config/Headers");
+      const auto templateRoot = IO::Path::Combine(currentWorkingDirectory, "config/Templates");
+      const auto benchmarkRoot = GetBenchmarkOutputRoot();
+
+      const auto knownJobs = GetKnownJobs();
+      const std::vector<std::string> benchmarkJobNames = {"RapidVulkan1.0", "RapidOpenCL1", "RapidOpenGLES3.2", "RapidOpenVX1.1"};
+      std::vector<const GeneratorJob*> jobs;
+      for (const auto& name : benchmarkJobNames)
+      {
+        auto itrFind =
+          std::find_if(knownJobs.begin(), knownJobs.end(), [&name](const GeneratorJob& job) { return job.GetName() == name; });
+        if (itrFind == knownJobs.end())
+          throw std::runtime_error(fmt::format("Unknown benchmark job '{}'", name));
+        jobs.push_back(&(*itrFind));
+      }
+
+      std::cout << "Benchmarking " << jobs.size() << " job(s) over " << iterationCount << " iteration(s) writing to '"
+                << benchmarkRoot.ToUTF8String() << "'\n";
+
+      Profiler::Enable();
+      ScopedAsyncFileWriter scopedFileWriter(std::make_shared<AsyncFileWriter>());
+
+      PipelineBenchmark benchmark;
+      for (uint32_t iteration = 0; iteration < iterationCount; ++iteration)
+      {
+        const auto iterationRoot = IO::Path::Combine(benchmarkRoot, fmt::format("iteration{}", iteration));
+        const Config config(headerRoot, templateRoot, iterationRoot, historyWorkerCount);
+        for (const auto* pJob : jobs)
+        {
+          const ResolvedJob resolvedJob(programInfo, config, *pJob);
+          Profiler::Clear();
+
+          PipelineBenchmarkSample sample;
+          const auto captureStart = Profiler::GetTime();
+          const auto capture = CaptureAPI(resolvedJob, config.HistoryWorkerCount, std::shared_ptr<CaptureCache>());
+          sample.CaptureWallTime = Profiler::GetTime() - captureStart;
+          sample.ResidentSetSizeAfterCapture = Profiler::GetResidentSetSize();
+
+          const auto generateStart = Profiler::GetTime();
+          RunJob(resolvedJob, *capture);
+          sample.GenerateWallTime = Profiler::GetTime() - generateStart;
+          sample.ResidentSetSizeAfterGenerate = Profiler::GetResidentSetSize();
+          sample.ProcessPeakResidentSetSize = Profiler::GetPeakResidentSetSize();
+
+          const Capture& theCapture = capture->Data->TheCapture;
+          sample.SymbolCount = theCapture.GetFunctions().size() + theCapture.GetStructs().size() + theCapture.GetEnumDict().size();
+          sample.PhaseTotals = Profiler::GetPhaseTotals();
+          benchmark.AddSample(pJob->GetName(), sample);
+        }
+        // The output is only written to measure the write stage, so it is removed before the next iteration
+        TryDeleteDirectoryTree(iterationRoot);
+      }
+      IO::Directory::TryDelete(benchmarkRoot);
+      benchmark.Report(std::cout);
+    }
+
+
+    struct CommandLine
+    {
+      bool BenchmarkStrings;
+      bool BenchmarkPipeline;
+      uint32_t BenchmarkIterationCount;
+      bool ListJobs;
+      bool AllJobs;
+      bool Watch;
+      bool CacheTranslationUnits;
+      bool StructLayoutReport;
+      std::vector<std::string> JobNames;
+      uint32_t JobCount;
+      //! The number of threads used to capture the API history (0 = divide the hardware concurrency between the jobs)
+      uint32_t HistoryWorkerCount;
+      std::string ProfilePath;
+
+      CommandLine()
+        : BenchmarkStrings(false)
+        , BenchmarkPipeline(false)
+        , BenchmarkIterationCount(5)
+        , ListJobs(false)
+        , AllJobs(false)
+        , Watch(false)
+        , CacheTranslationUnits(false)
+        , StructLayoutReport(false)
+        , JobCount(1)
+        , HistoryWorkerCount(0)
+      {
+      }
+    };
+
+
+    void PrintUsage(std::ostream& rStream)
+    {
+      rStream << "Usage: RAIIGen [options]\n"
+              << "  --job <name>           Generate the named template set, can be specified multiple times (see --list)\n"
+              << "  --all                  Generate all known template sets\n"
+              << "  --list                 List the known template sets, the default ones are marked with a '*'\n"
+              << "                         Template sets whose header or templates are missing are marked unavailable and skipped\n"
+              << "  -j, --jobs <count>     The number of jobs to run in parallel (0 = use the hardware concurrency, default 1)\n"
+              << "  --history-workers <n>  The number of threads used to capture the API history of each job (0 = automatic, 1 = serial)\n"
+              << "  --watch                Keep running and regenerate the jobs affected by changes to their headers or templates\n"
+              << "  --tu-cache             Cache the parsed translation units below 'cache/translation-unit' to speed up reruns\n"
+              << "  --layout-report        Write the struct layout and padding report RAIIGenStructLayout.txt to each job output\n"
+              << "  --profile <file>       Write a phase profile of the run as a Chrome trace JSON file (chrome://tracing)\n"
+              << "  --benchmark            Run the end-to-end pipeline benchmark, the output is written to the temp directory\n"
+              << "  --iterations <count>   The number of times the pipeline benchmark runs each job (default 5)\n"
+              << "  --benchmark-strings    Run the string replacement benchmark\n"
+              << "  -h, --help             Show this help\n";
+    }
+
+
+    //! @return false if the program should exit
+    bool TryParseCommandLine(CommandLine& rCommandLine, int argc, char** argv)
+    {
+      for (int i = 1; i < argc; ++i)
+      {
+        const std::string arg(argv[i]);
+        auto getValue = [&]() {
+          if ((i + 1) >= argc)
+            throw std::invalid_argument(fmt::format("Missing value for '{}'", arg));
+          ++i;
+          return std::string(argv[i]);
+        };
+
+        auto getCount = [&]() {
+          const auto value = getValue();
+          if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos)
+            throw std::invalid_argument(fmt::format("Invalid count '{}' for '{}'", value, arg));
+          return static_cast<uint32_t>(std::stoul(value));
+        };
+
+        if (arg == "--benchmark-strings")
+          rCommandLine.BenchmarkStrings = true;
+        else if (arg == "--benchmark")
+          rCommandLine.BenchmarkPipeline = true;
+        else if (arg == "--iterations")
+        {
+          rCommandLine.BenchmarkIterationCount = getCount();
+          if (rCommandLine.BenchmarkIterationCount < 1)
+            throw std::invalid_argument("The iteration count must be at least 1");
+        }
+        else if (arg == "--list")
+          rCommandLine.ListJobs = true;
+        else if (arg == "--all")
+          rCommandLine.AllJobs = true;
+        else if (arg == "--watch")
+          rCommandLine.Watch = true;
+        else if (arg == "--tu-cache")
+          rCommandLine.CacheTranslationUnits = true;
+        else if (arg == "--layout-report")
+          rCommandLine.StructLayoutReport = true;
+        else if (arg == "--profile")
+          rCommandLine.ProfilePath = getValue();
+        else if (arg == "--job")
+          rCommandLine.JobNames.push_back(getValue());
+        else if (arg == "-j" || arg == "--jobs")
+          rCommandLine.JobCount = getCount();
+        else if (arg == "--history-workers")
+          rCommandLine.HistoryWorkerCount = getCount();
+        else if (arg == "-h" || arg == "--help")
+        {
+          PrintUsage(std::cout);
+          return false;
+        }
+        else
+        {
+          PrintUsage(std::cout);
+          throw std::invalid_argument(fmt::format("Unknown argument '{}'", arg));
+        }
+      }
+      return true;
+    }
+
+
+    std::vector<const GeneratorJob*> SelectJobs(const std::vector<GeneratorJob>& knownJobs, const CommandLine& commandLine)
+    {
+      std::vector<const GeneratorJob*> result;
+      if (commandLine.AllJobs)
+      {
+        for (const auto& job : knownJobs)
+          result.push_back(&job);
+        return result;
+      }
+
+      if (commandLine.JobNames.empty())
+      {
+        for (const auto& job : knownJobs)
+        {
+          if (job.IsDefault)
+            result.push_back(&job);
+        }
+        return result;
+      }
+
+      for (const auto& name : commandLine.JobNames)
+      {
+        auto itrFind =
+          std::find_if(knownJobs.begin(), knownJobs.end(), [&name](const GeneratorJob& job) { return job.GetName() == name; });
+        if (itrFind == knownJobs.end())
+          throw std::invalid_argument(fmt::format("Unknown job '{}', use --list to see the known jobs", name));
+        if (std::find(result.begin(), result.end(), &(*itrFind)) == result.end())
+          result.push_back(&(*itrFind));
+      }
+      return result;
+    }
+
+
+    void GenerateClasses(const ProgramInfo& programInfo, const IO::Path& currentWorkingDirectory, const CommandLine& commandLine)
     {
       const auto headerRoot = IO::Path::Combine(currentWorkingDirectory, "config/Headers");
       const auto templateRoot = IO::Path::Combine(currentWorkingDirectory, "config/Templates");
       const auto outputRoot = IO::Path::Combine(currentWorkingDirectory, "output");
+      const auto captureCachePath = IO::Path::Combine(currentWorkingDirectory, "cache/capture");
+
+      Config config(headerRoot, templateRoot, outputRoot, commandLine.HistoryWorkerCount, captureCachePath);
+      // The saved translation units are large, so caching them is opt-in
+      if (commandLine.CacheTranslationUnits)
+        config.TranslationUnitCachePath = IO::Path::Combine(currentWorkingDirectory, "cache/translation-unit");
+      config.JobCount = commandLine.JobCount;
+      config.WriteStructLayoutReport = commandLine.StructLayoutReport;
+      if (!commandLine.ProfilePath.empty())
+      {
+        const IO::Path profilePath(commandLine.ProfilePath);
+        config.ProfilePath = IO::Path::IsPathRooted(profilePath) ? profilePath : IO::Path::Combine(currentWorkingDirectory, profilePath);
+        Profiler::Enable();
+      }
+
+      const auto knownJobs = GetKnownJobs();
+      if (commandLine.ListJobs)
+      {
+        for (const auto& job : knownJobs)
+        {
+          std::cout << (job.IsDefault ? "* " : "  ") << job.GetName();
+          const auto unavailableReason = ResolvedJob(programInfo, config, job).GetUnavailableReason();
+          if (!unavailableReason.empty())
+            std::cout << " (unavailable: " << unavailableReason << ")";
+          std::cout << "\n";
+        }
+        return;
+      }
+
+      const auto jobs = SelectJobs(knownJobs, commandLine);
+      const auto parallelJobCount = DivideWorkersBetweenJobs(config, jobs.size());
 
-      Config config(headerRoot, templateRoot, outputRoot);
-
-      //RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "OpenCL", "OpenCL", "1", true);
-      //RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "OpenCL", "OpenCL", "1.1");
-      //RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "OpenCL", "OpenCL", "1.2");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "OpenCL", "OpenCL", "2.0");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "OpenCL", "OpenCL", "2.1");
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "OpenVX", "OpenVX", "1.0.1");
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "OpenVX", "OpenVX", "1.1");
-      // RunGenerator<MB::VulkanGenerator>(programInfo, config, "vulkan/vulkan.h", "Vulkan", "Vulkan", "1.0");
-
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "1.1");
-      //RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "1");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "1.2");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "2.0");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "2.1");
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "RapidOpenVX", "OpenVX", "1.0.1");
-
-      // RapidOpenCL1
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "1", true); // RapidOpenCL current release based on OpenCL1.2
-
-      // RapidOpenCL2
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "RapidOpenCL", "OpenCL", "2", true);
-
-      // RapidOpenVX
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "RapidOpenVX", "OpenVX", "1.0.1", true);
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "RapidOpenVX", "OpenVX", "1.1", true);
-
-      // RapidVulkan
-      RunGenerator<MB::VulkanGenerator>(programInfo, config, "vulkan/vulkan.h", "RapidVulkan", "Vulkan", "1.0", true);
-      // RunGenerator<MB::VulkanGenerator>(programInfo, config, "vulkan/vulkan.h", "RapidVulkan", "Vulkan", "1.1", true);
-
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "FslUtilOpenCL", "OpenCL", "1.1");
-      // RunGenerator<MB::OpenCLGenerator>(programInfo, config, "CL/cl.h", "FslUtilOpenCL", "OpenCL", "1.2");
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "FslUtilOpenVX", "OpenVX", "1.0.1");
-      // RunGenerator<MB::OpenVXGenerator>(programInfo, config, "VX/vx.h", "FslUtilOpenVX", "OpenVX", "1.1");
-      // RunGenerator<MB::VulkanGenerator>(programInfo, config, "vulkan/vulkan.h", "FslUtil.Vulkan", "Vulkan", "1.0");
-
-      // RunGenerator<MB::OpenGLESGenerator>(programInfo, config, "GLES2/gl2.h", "RapidOpenGLES", "OpenGLES", "2.0");
-      // RunGenerator<MB::OpenGLESGenerator>(programInfo, config, "GLES3/gl3.h", "RapidOpenGLES", "OpenGLES", "3.0");
-      // RunGenerator<MB::OpenGLESGenerator>(programInfo, config, "GLES3/gl31.h", "RapidOpenGLES", "OpenGLES", "3.1");
-      // RunGenerator<MB::OpenGLESGenerator>(programInfo, config, "GLES3/gl32.h", "RapidOpenGLES", "OpenGLES", "3.2");
+      // Generated files are written in the background so the generators never block on the disk
+      ScopedAsyncFileWriter scopedFileWriter(std::make_shared<AsyncFileWriter>(config.WriterWorkerCount));
+      // Parallel jobs have their console output buffered so it doesn't interleave
+      ScopedJobConsole scopedJobConsole(parallelJobCount > 1);
+
+      JobGraph graph;
+      BuildJobGraph(graph, programInfo, config, jobs);
+      RunAllJobs(graph, config);
+      WriteProfile(config);
+      if (commandLine.Watch)
+        WatchJobs(graph, config);
     }
   }
 }
@@ -397,7 +1173,23 @@ int main(int argc, char** argv)
 
   try
   {
-    GenerateClasses(ProgramInfo(g_programName, g_programVersion), currentPath);
+    CommandLine commandLine;
+    if (!TryParseCommandLine(commandLine, argc, argv))
+      return EXIT_SUCCESS;
+
+    if (commandLine.BenchmarkStrings)
+    {
+      StringBenchmark::Run(std::cout);
+      return EXIT_SUCCESS;
+    }
+    if (commandLine.BenchmarkPipeline)
+    {
+      RunPipelineBenchmark(ProgramInfo(g_programName, g_programVersion), currentPath, commandLine.BenchmarkIterationCount,
+                           commandLine.HistoryWorkerCount);
+      return EXIT_SUCCESS;
+    }
+
+    GenerateClasses(ProgramInfo(g_programName, g_programVersion), currentPath, commandLine);
   }
   catch (const std::exception& ex)
   {
@@ -405,4 +1197,4 @@ int main(int argc, char** argv)
     return EXIT_FAILURE;
   }
   return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
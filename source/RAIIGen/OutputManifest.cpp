@@ -0,0 +1,203 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/OutputManifest.hpp>
+#include <RAIIGen/HashUtil.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const std::string MANIFEST_HEADER = "RAIIGenOutputManifest";
+    //! Increase this whenever the manifest layout or the hash changes
+    const uint32_t MANIFEST_FORMAT_VERSION = 1;
+
+
+    uint64_t HashContent(const std::string& content)
+    {
+      Fnv1aHasher hasher;
+      hasher.Add(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+      return hasher.GetHash();
+    }
+
+
+    bool TryLoad(std::unordered_map<std::string, OutputManifestEntry>& rEntries, const IO::Path& path)
+    {
+      std::string content;
+      if (!IO::File::TryReadAllText(content, path))
+        return false;
+
+      std::istringstream contentStream(content);
+      std::string line;
+      if (!std::getline(contentStream, line) || line != fmt::format("{} {}", MANIFEST_HEADER, MANIFEST_FORMAT_VERSION))
+        return false;
+
+      std::unordered_map<std::string, OutputManifestEntry> entries;
+      while (std::getline(contentStream, line))
+      {
+        if (line.empty())
+          continue;
+
+        std::istringstream lineStream(line);
+        OutputManifestEntry entry;
+        if (!(lineStream >> std::hex >> entry.ContentHash >> std::dec >> entry.Size >> entry.LastWriteTime))
+          return false;
+        // The relative path is the remainder of the line so it can contain spaces
+        std::string name;
+        lineStream.get();
+        if (!std::getline(lineStream, name) || name.empty())
+          return false;
+        entries[name] = entry;
+      }
+      rEntries = std::move(entries);
+      return true;
+    }
+  }
+
+
+  OutputManifest::OutputManifest(const IO::Path& rootPath)
+    : m_rootPath(rootPath)
+    , m_manifestPath(IO::Path::Combine(rootPath, GetFileName()))
+    , m_rootPrefix(rootPath.ToUTF8String())
+    , m_isDirty(false)
+  {
+    if (!m_rootPrefix.empty() && m_rootPrefix.back() != '/')
+      m_rootPrefix += '/';
+
+    // A missing or invalid manifest just means that every file will be compared against the content on disk
+    if (!TryLoad(m_entries, m_manifestPath))
+      m_entries.clear();
+  }
+
+
+  bool OutputManifest::Contains(const IO::Path& fileName) const
+  {
+    const auto strFileName = fileName.ToUTF8String();
+    return strFileName.size() > m_rootPrefix.size() && strFileName.compare(0, m_rootPrefix.size(), m_rootPrefix) == 0;
+  }
+
+
+  bool OutputManifest::WriteAllTextIfChanged(const IO::Path& fileName, const std::string& content)
+  {
+    const auto relativePath = GetRelativePath(fileName);
+    const auto contentHash = HashContent(content);
+    const auto contentSize = static_cast<uint64_t>(content.size());
+
+    uint64_t size = 0;
+    uint64_t lastWriteTime = 0;
+    const bool exists = IO::File::TryGetStatus(fileName, size, lastWriteTime);
+    if (exists)
+    {
+      bool isMetadataMatch = false;
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto itr = m_entries.find(relativePath);
+        if (itr != m_entries.end() && itr->second.Size == size && itr->second.LastWriteTime == lastWriteTime)
+        {
+          isMetadataMatch = true;
+          if (itr->second.ContentHash == contentHash && size == contentSize)
+          {
+            itr->second.Touched = true;
+            return false;
+          }
+        }
+      }
+
+      // The file was modified outside of our control (or we never recorded it), so fall back to a full compare
+      std::string currentContent;
+      if (!isMetadataMatch && size == contentSize && IO::File::TryReadAllText(currentContent, fileName) && currentContent == content)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries[relativePath] = OutputManifestEntry(contentHash, size, lastWriteTime);
+        m_isDirty = true;
+        return false;
+      }
+    }
+
+    IOUtil::WriteAllTextAtomic(fileName, content);
+    if (!IO::File::TryGetStatus(fileName, size, lastWriteTime))
+      throw std::runtime_error(fmt::format("Failed to get the status of the written file '{}'", fileName.ToUTF8String()));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[relativePath] = OutputManifestEntry(contentHash, size, lastWriteTime);
+    m_isDirty = true;
+    return true;
+  }
+
+
+  void OutputManifest::Save()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Drop the entries for files that are no longer generated
+    for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    {
+      if (!itr->second.Touched)
+      {
+        itr = m_entries.erase(itr);
+        m_isDirty = true;
+      }
+      else
+        ++itr;
+    }
+    if (!m_isDirty)
+      return;
+
+    std::vector<const std::pair<const std::string, OutputManifestEntry>*> entries;
+    entries.reserve(m_entries.size());
+    for (const auto& entry : m_entries)
+      entries.push_back(&entry);
+    std::sort(entries.begin(), entries.end(), [](const std::pair<const std::string, OutputManifestEntry>* pLhs,
+                                                 const std::pair<const std::string, OutputManifestEntry>* pRhs) { return pLhs->first < pRhs->first; });
+
+    std::string content = fmt::format("{} {}\n", MANIFEST_HEADER, MANIFEST_FORMAT_VERSION);
+    for (const auto pEntry : entries)
+    {
+      content += fmt::format("{:016x} {} {} {}\n", pEntry->second.ContentHash, pEntry->second.Size, pEntry->second.LastWriteTime, pEntry->first);
+    }
+    IOUtil::WriteAllTextAtomic(m_manifestPath, content);
+    m_isDirty = false;
+  }
+
+
+  const char* OutputManifest::GetFileName()
+  {
+    return "RAIIGenOutputManifest.txt";
+  }
+
+
+  std::string OutputManifest::GetRelativePath(const IO::Path& fileName) const
+  {
+    if (!Contains(fileName))
+      throw std::invalid_argument(fmt::format("The file '{}' is not located below '{}'", fileName.ToUTF8String(), m_rootPath.ToUTF8String()));
+    return fileName.ToUTF8String().substr(m_rootPrefix.size());
+  }
+}
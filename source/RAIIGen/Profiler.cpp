@@ -0,0 +1,468 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Profiler.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <FslBase/System/HighResolutionTimer.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__) || defined(__QNXNTO__)
+#include <sys/resource.h>
+#include <unistd.h>
+#include <fstream>
+#endif
+
+namespace
+{
+  // These are updated by the global allocation functions below, so they must be usable before any other static is initialized.
+  // The process totals are reported in the trace, the thread counters give the profile scopes the allocations made by their own thread.
+  // Nothing is counted until the profiler is enabled, so a normal run only pays for one relaxed load per allocation.
+  std::atomic<bool> g_countAllocations(false);
+  std::atomic<uint64_t> g_allocationCount(0);
+  std::atomic<uint64_t> g_allocatedBytes(0);
+  thread_local uint64_t g_threadAllocationCount = 0;
+  thread_local uint64_t g_threadAllocatedBytes = 0;
+
+
+  void* Allocate(std::size_t size)
+  {
+    if (g_countAllocations.load(std::memory_order_relaxed))
+    {
+      g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+      g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+      ++g_threadAllocationCount;
+      g_threadAllocatedBytes += size;
+    }
+    if (size == 0)
+      size = 1;
+    return std::malloc(size);
+  }
+}
+
+
+// Replace the global allocation functions so the profiler can report allocation counts.
+// NOTE: This replaces them for the entire executable, but the counters are only updated once the profiler has been enabled.
+void* operator new(std::size_t size)
+{
+  void* pMemory = Allocate(size);
+  if (pMemory == nullptr)
+    throw std::bad_alloc();
+  return pMemory;
+}
+
+
+void* operator new[](std::size_t size)
+{
+  void* pMemory = Allocate(size);
+  if (pMemory == nullptr)
+    throw std::bad_alloc();
+  return pMemory;
+}
+
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return Allocate(size);
+}
+
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return Allocate(size);
+}
+
+
+void operator delete(void* pMemory) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete[](void* pMemory) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete(void* pMemory, std::size_t) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete[](void* pMemory, std::size_t) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete(void* pMemory, const std::nothrow_t&) noexcept
+{
+  std::free(pMemory);
+}
+
+
+void operator delete[](void* pMemory, const std::nothrow_t&) noexcept
+{
+  std::free(pMemory);
+}
+
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    enum class EventType
+    {
+      Complete,
+      Counter
+    };
+
+    struct Event
+    {
+      EventType Type;
+      std::string Name;
+      std::string Job;
+      uint32_t ThreadId;
+      uint64_t StartTime;
+      uint64_t Duration;
+      uint64_t AllocationCount;
+      uint64_t AllocatedBytes;
+    };
+
+    struct ProfilerState
+    {
+      std::atomic<bool> IsEnabled;
+      HighResolutionTimer Timer;
+      uint64_t StartTime;
+      std::mutex Mutex;
+      std::vector<Event> Events;
+      std::unordered_map<std::thread::id, uint32_t> ThreadIds;
+
+      ProfilerState()
+        : IsEnabled(false)
+        , StartTime(Timer.GetTime())
+      {
+      }
+    };
+
+
+    ProfilerState& GetState()
+    {
+      static ProfilerState state;
+      return state;
+    }
+
+
+    std::string& GetThreadJobStorage()
+    {
+      static thread_local std::string job;
+      return job;
+    }
+
+
+    uint32_t GetThreadId(ProfilerState& rState)
+    {
+      const auto result = rState.ThreadIds.emplace(std::this_thread::get_id(), static_cast<uint32_t>(rState.ThreadIds.size() + 1));
+      return result.first->second;
+    }
+
+
+    std::string EscapeJson(const std::string& value)
+    {
+      std::string result;
+      result.reserve(value.size());
+      for (const char ch : value)
+      {
+        switch (ch)
+        {
+        case '"':
+          result += "\\\"";
+          break;
+        case '\\':
+          result += "\\\\";
+          break;
+        case '\n':
+          result += "\\n";
+          break;
+        case '\r':
+          result += "\\r";
+          break;
+        case '\t':
+          result += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(ch) < 0x20)
+            result += fmt::format("\\u{:04x}", static_cast<unsigned>(ch));
+          else
+            result += ch;
+          break;
+        }
+      }
+      return result;
+    }
+
+
+    //! The totals are sorted on (job, phase) so the output is stable
+    ProfilePhaseTotals CalculateTotals(const std::vector<Event>& events)
+    {
+      ProfilePhaseTotals totals;
+      for (const auto& event : events)
+      {
+        if (event.Type != EventType::Complete)
+          continue;
+        auto& rTotal = totals[std::make_pair(event.Job, event.Name)];
+        ++rTotal.Count;
+        rTotal.Duration += event.Duration;
+        rTotal.AllocationCount += event.AllocationCount;
+        rTotal.AllocatedBytes += event.AllocatedBytes;
+      }
+      return totals;
+    }
+  }
+
+
+  void Profiler::Enable()
+  {
+    GetState().IsEnabled = true;
+    g_countAllocations.store(true, std::memory_order_relaxed);
+  }
+
+
+  bool Profiler::IsEnabled()
+  {
+    return GetState().IsEnabled;
+  }
+
+
+  uint64_t Profiler::GetTime()
+  {
+    auto& rState = GetState();
+    return rState.Timer.GetTime() - rState.StartTime;
+  }
+
+
+  void Profiler::AddEvent(const char* const pszName, const uint64_t startTime, const uint64_t duration, const uint64_t allocationCount,
+                          const uint64_t allocatedBytes)
+  {
+    auto& rState = GetState();
+    if (!rState.IsEnabled)
+      return;
+
+    Event event{EventType::Complete, pszName, GetThreadJob(), 0, startTime, duration, allocationCount, allocatedBytes};
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    event.ThreadId = GetThreadId(rState);
+    rState.Events.push_back(std::move(event));
+  }
+
+
+  void Profiler::AddMemorySample()
+  {
+    auto& rState = GetState();
+    if (!rState.IsEnabled)
+      return;
+
+    Event event{EventType::Counter, "PeakResidentSetSize", GetThreadJob(), 0, GetTime(), 0, GetAllocationCount(), GetPeakResidentSetSize()};
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    event.ThreadId = GetThreadId(rState);
+    rState.Events.push_back(std::move(event));
+  }
+
+
+  const std::string& Profiler::GetThreadJob()
+  {
+    return GetThreadJobStorage();
+  }
+
+
+  void Profiler::SetThreadJob(const std::string& name)
+  {
+    GetThreadJobStorage() = name;
+  }
+
+
+  uint64_t Profiler::GetAllocationCount()
+  {
+    return g_allocationCount.load(std::memory_order_relaxed);
+  }
+
+
+  uint64_t Profiler::GetAllocatedBytes()
+  {
+    return g_allocatedBytes.load(std::memory_order_relaxed);
+  }
+
+
+  uint64_t Profiler::GetThreadAllocationCount()
+  {
+    return g_threadAllocationCount;
+  }
+
+
+  uint64_t Profiler::GetThreadAllocatedBytes()
+  {
+    return g_threadAllocatedBytes;
+  }
+
+
+  void Profiler::AddThreadAllocations(const uint64_t allocationCount, const uint64_t allocatedBytes)
+  {
+    g_threadAllocationCount += allocationCount;
+    g_threadAllocatedBytes += allocatedBytes;
+  }
+
+
+  uint64_t Profiler::GetResidentSetSize()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+      return 0;
+    return static_cast<uint64_t>(counters.WorkingSetSize);
+#elif defined(__linux__)
+    // The second field is the resident set size in pages
+    std::ifstream file("/proc/self/statm");
+    uint64_t sizePages = 0;
+    uint64_t residentPages = 0;
+    if (!(file >> sizePages >> residentPages))
+      return 0;
+    return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+  }
+
+
+  uint64_t Profiler::GetPeakResidentSetSize()
+  {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+      return 0;
+    return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+#elif defined(__linux__) || defined(__QNXNTO__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+      return 0;
+    // ru_maxrss is reported in kilobytes
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#else
+    return 0;
+#endif
+  }
+
+
+  void Profiler::Clear()
+  {
+    auto& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    rState.Events.clear();
+  }
+
+
+  ProfilePhaseTotals Profiler::GetPhaseTotals()
+  {
+    auto& rState = GetState();
+    std::lock_guard<std::mutex> lock(rState.Mutex);
+    return CalculateTotals(rState.Events);
+  }
+
+
+  void Profiler::WriteChromeTrace(const IO::Path& path)
+  {
+    auto& rState = GetState();
+    std::vector<Event> events;
+    {
+      std::lock_guard<std::mutex> lock(rState.Mutex);
+      events = rState.Events;
+    }
+
+    std::string content("{\n\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [\n");
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+      const auto& event = events[i];
+      if (event.Type == EventType::Complete)
+      {
+        content += fmt::format(
+          "{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"pid\": 1, \"tid\": {}, \"ts\": {}, \"dur\": {}, \"args\": {{\"job\": \"{}\", "
+          "\"allocations\": {}, \"allocatedBytes\": {}}}}}",
+          EscapeJson(event.Name), EscapeJson(event.Job), event.ThreadId, event.StartTime, event.Duration, EscapeJson(event.Job),
+          event.AllocationCount, event.AllocatedBytes);
+      }
+      else
+      {
+        content += fmt::format("{{\"name\": \"{}\", \"ph\": \"C\", \"pid\": 1, \"tid\": {}, \"ts\": {}, \"args\": {{\"bytes\": {}}}}}",
+                               EscapeJson(event.Name), event.ThreadId, event.StartTime, event.AllocatedBytes);
+      }
+      content += (i + 1) < events.size() ? ",\n" : "\n";
+    }
+    content += "],\n\"phaseTotals\": [\n";
+
+    const auto totals = CalculateTotals(events);
+    std::size_t index = 0;
+    for (const auto& entry : totals)
+    {
+      content += fmt::format(
+        "{{\"job\": \"{}\", \"phase\": \"{}\", \"count\": {}, \"durationUs\": {}, \"allocations\": {}, \"allocatedBytes\": {}}}{}\n",
+        EscapeJson(entry.first.first), EscapeJson(entry.first.second), entry.second.Count, entry.second.Duration, entry.second.AllocationCount,
+        entry.second.AllocatedBytes, (++index) < totals.size() ? "," : "");
+    }
+    content += fmt::format("],\n\"otherData\": {{\"peakResidentSetSize\": \"{}\", \"allocations\": \"{}\", \"allocatedBytes\": \"{}\"}}\n}}\n",
+                           GetPeakResidentSetSize(), GetAllocationCount(), GetAllocatedBytes());
+
+    IOUtil::WriteAllTextAtomic(path, content);
+  }
+
+
+  void Profiler::WriteSummary(std::ostream& rStream)
+  {
+    auto& rState = GetState();
+    std::vector<Event> events;
+    {
+      std::lock_guard<std::mutex> lock(rState.Mutex);
+      events = rState.Events;
+    }
+
+    rStream << "Profile summary\n";
+    for (const auto& entry : CalculateTotals(events))
+    {
+      rStream << fmt::format("- {:<24} {:<24} {:>6}x {:>12.3f}ms {:>10} allocations\n", entry.first.first.empty() ? "-" : entry.first.first,
+                             entry.first.second, entry.second.Count, entry.second.Duration / 1000.0, entry.second.AllocationCount);
+    }
+    rStream << fmt::format("Peak resident set size: {:.1f}MB, allocations: {}\n", GetPeakResidentSetSize() / (1024.0 * 1024.0),
+                           GetAllocationCount());
+  }
+}
@@ -0,0 +1,115 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/Symbol.hpp>
+#include <array>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+
+namespace MB
+{
+  namespace
+  {
+    //! @brief The table is split into shards selected by the hash of the string, so threads that intern different strings rarely contend for
+    //!        the same lock.
+    class SymbolTable
+    {
+      static const std::size_t SHARD_COUNT = 64;
+
+      struct Shard
+      {
+        std::mutex Lock;
+        //! The set is node based so the address of a entry never changes
+        std::unordered_set<std::string> Entries;
+      };
+
+      std::array<Shard, SHARD_COUNT> m_shards;
+
+    public:
+      const std::string* Intern(const std::string& value)
+      {
+        auto& rShard = GetShard(value);
+        std::lock_guard<std::mutex> lock(rShard.Lock);
+        return &(*rShard.Entries.insert(value).first);
+      }
+
+      //! @return the interned string or null if the string was never interned
+      const std::string* TryFind(const std::string& value)
+      {
+        auto& rShard = GetShard(value);
+        std::lock_guard<std::mutex> lock(rShard.Lock);
+        const auto itrFind = rShard.Entries.find(value);
+        return itrFind != rShard.Entries.end() ? &(*itrFind) : nullptr;
+      }
+
+    private:
+      Shard& GetShard(const std::string& value)
+      {
+        return m_shards[std::hash<std::string>()(value) % SHARD_COUNT];
+      }
+    };
+
+
+    SymbolTable& GetSymbolTable()
+    {
+      // Intentionally leaked so symbols stay valid during static destruction
+      static SymbolTable* g_pTable = new SymbolTable();
+      return *g_pTable;
+    }
+
+
+    const std::string* GetEmptySymbol()
+    {
+      static const std::string* g_pEmpty = GetSymbolTable().Intern(std::string());
+      return g_pEmpty;
+    }
+  }
+
+
+  Symbol::Symbol()
+    : m_pValue(GetEmptySymbol())
+  {
+  }
+
+
+  Symbol::Symbol(const std::string& value)
+    : m_pValue(value.empty() ? GetEmptySymbol() : GetSymbolTable().Intern(value))
+  {
+  }
+
+
+  Symbol::Symbol(const char* const psz)
+    : Symbol(std::string(psz != nullptr ? psz : ""))
+  {
+  }
+
+
+  bool Symbol::TryFind(Symbol& rSymbol, const std::string& value)
+  {
+    const std::string* const pValue = value.empty() ? GetEmptySymbol() : GetSymbolTable().TryFind(value);
+    if (pValue == nullptr)
+      return false;
+    rSymbol.m_pValue = pValue;
+    return true;
+  }
+}
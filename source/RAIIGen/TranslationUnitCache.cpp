@@ -0,0 +1,172 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/TranslationUnitCache.hpp>
+#include <RAIIGen/HashUtil.hpp>
+#include <RAIIGen/IOUtil.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <fmt/format.h>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    //! Increase this whenever the dependency file layout changes
+    const uint32_t DEPENDENCY_FORMAT_VERSION = 1;
+
+    std::atomic<uint32_t> g_tempFileCounter(0);
+
+
+    std::string GetClangVersion()
+    {
+      CXString version = clang_getClangVersion();
+      std::string result(clang_getCString(version));
+      clang_disposeString(version);
+      return result;
+    }
+
+
+    IO::Path GetTranslationUnitPath(const IO::Path& cachePath, const uint64_t key)
+    {
+      return IO::Path::Combine(cachePath, fmt::format("{:016x}.ast", key));
+    }
+
+
+    IO::Path GetDependencyPath(const IO::Path& cachePath, const uint64_t key)
+    {
+      return IO::Path::Combine(cachePath, fmt::format("{:016x}.deps", key));
+    }
+
+
+    //! @brief Parse a hash written as 16 hex digits
+    bool TryParseHash(const std::string& text, uint64_t& rHash)
+    {
+      if (text.size() != 16 || text.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos)
+        return false;
+      rHash = std::stoull(text, nullptr, 16);
+      return true;
+    }
+
+
+    //! @brief Check that the dependency file exists and that none of the files it lists were modified since it was written
+    bool IsUpToDate(const IO::Path& dependencyPath)
+    {
+      std::string content;
+      if (!IO::File::TryReadAllText(content, dependencyPath))
+        return false;
+
+      std::istringstream stream(content);
+      std::string line;
+      if (!std::getline(stream, line) || line != fmt::format("RAIIGenTranslationUnit {}", DEPENDENCY_FORMAT_VERSION))
+        return false;
+
+      while (std::getline(stream, line))
+      {
+        // Each line is '{hash:016x} {path}', a corrupt line is treated as a cache miss
+        uint64_t hash;
+        if (line.size() < 18 || line[16] != ' ' || !TryParseHash(line.substr(0, 16), hash))
+          return false;
+        const IO::Path dependency(line.substr(17));
+        if (!IO::File::Exists(dependency) || HashUtil::HashFileContent(dependency) != hash)
+          return false;
+      }
+      return true;
+    }
+  }
+
+
+  TranslationUnitCache::TranslationUnitCache(const IO::Path& cachePath)
+    : m_cachePath(cachePath)
+  {
+  }
+
+
+  uint64_t TranslationUnitCache::CalculateKey(const IO::Path& filename, const std::deque<std::string>& clangArgs, const unsigned parseFlags)
+  {
+    // The saved translation units can only be loaded by the clang version that wrote them
+    static const std::string clangVersion = GetClangVersion();
+
+    Fnv1aHasher hasher;
+    hasher.Add(static_cast<uint64_t>(DEPENDENCY_FORMAT_VERSION));
+    hasher.Add(clangVersion);
+    hasher.Add(filename.ToUTF8String());
+    hasher.Add(static_cast<uint64_t>(clangArgs.size()));
+    for (const auto& arg : clangArgs)
+      hasher.Add(arg);
+    hasher.Add(static_cast<uint64_t>(parseFlags));
+    return hasher.GetHash();
+  }
+
+
+  CXTranslationUnit TranslationUnitCache::TryLoad(CXIndex index, const uint64_t key) const
+  {
+    const auto translationUnitPath = GetTranslationUnitPath(m_cachePath, key);
+    if (!IO::File::Exists(translationUnitPath) || !IsUpToDate(GetDependencyPath(m_cachePath, key)))
+      return nullptr;
+
+    CXTranslationUnit translationUnit = nullptr;
+    const auto errorCode = clang_createTranslationUnit2(index, translationUnitPath.ToUTF8String().c_str(), &translationUnit);
+    if (errorCode != CXError_Success)
+    {
+      std::cout << "WARNING: Ignoring translation unit cache entry '" << translationUnitPath.ToUTF8String() << "' (error " << errorCode << ")\n";
+      return nullptr;
+    }
+    return translationUnit;
+  }
+
+
+  void TranslationUnitCache::Store(CXTranslationUnit translationUnit, const uint64_t key, const std::vector<IO::Path>& includedFiles) const
+  {
+    const auto translationUnitPath = GetTranslationUnitPath(m_cachePath, key);
+    const IO::Path tempFileName(fmt::format("{}.{}.raiigen.tmp", translationUnitPath.ToUTF8String(), g_tempFileCounter++));
+
+    // Failing to update the cache is not fatal, we just parse the file again next time
+    try
+    {
+      std::string dependencies = fmt::format("RAIIGenTranslationUnit {}\n", DEPENDENCY_FORMAT_VERSION);
+      for (const auto& file : includedFiles)
+        dependencies += fmt::format("{:016x} {}\n", HashUtil::HashFileContent(file), file.ToUTF8String());
+
+      IO::Directory::CreateDir(m_cachePath);
+      const auto result = clang_saveTranslationUnit(translationUnit, tempFileName.ToUTF8String().c_str(), clang_defaultSaveOptions(translationUnit));
+      if (result != CXSaveError_None)
+        throw std::runtime_error(fmt::format("clang_saveTranslationUnit failed with error {}", result));
+
+      // The translation unit is moved in place before its dependencies are written, so a entry is never considered up to date with the
+      // dependencies of a older translation unit.
+      IO::File::Move(tempFileName, translationUnitPath);
+      IOUtil::WriteAllTextAtomic(GetDependencyPath(m_cachePath, key), dependencies);
+    }
+    catch (const std::exception& ex)
+    {
+      IO::File::TryDelete(tempFileName);
+      std::cout << "WARNING: Failed to write translation unit cache entry '" << translationUnitPath.ToUTF8String() << "': " << ex.what() << "\n";
+    }
+  }
+}
@@ -0,0 +1,121 @@
+//***************************************************************************************************************************************************
+//* BSD 3-Clause License
+//*
+//* Copyright (c) 2026, Rene Thrane
+//* All rights reserved.
+//*
+//* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+//*
+//* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+//* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the
+//*    documentation and/or other materials provided with the distribution.
+//* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this
+//*    software without specific prior written permission.
+//*
+//* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+//* CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//* PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+//* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//***************************************************************************************************************************************************
+
+#include <RAIIGen/VersionIndex.hpp>
+#include <RAIIGen/HistoryDelta.hpp>
+#include <FslBase/Exceptions.hpp>
+
+namespace MB
+{
+  using namespace Fsl;
+
+  namespace
+  {
+    const VersionRecord& Lookup(const std::unordered_map<std::string, VersionRecord>& dict, const std::string& name)
+    {
+      const auto itrFind = dict.find(name);
+      if (itrFind == dict.end())
+      {
+        // This means that the file we are scanning is not part of the history, so its a user error
+        throw NotFoundException(std::string("'") + name + "' could not be found in history");
+      }
+      return itrFind->second;
+    }
+  }
+
+
+  VersionIndex::VersionIndex()
+  {
+  }
+
+
+  void VersionIndex::Add(const HistoryDelta& delta)
+  {
+    // Since the deltas are added in version order the first insert of a name is its first appearance.
+    // A symbol that was removed and later re-added keeps the version it originally appeared in.
+    for (const auto& name : delta.Structs)
+      AddStruct(name, delta.Version);
+
+    for (const auto& name : delta.Functions)
+      AddFunction(name, delta.Version);
+
+    for (const auto& name : delta.Enums)
+      AddEnum(name, delta.Version);
+
+    for (const auto& entry : delta.EnumMembers)
+    {
+      for (const auto& name : entry.second)
+        AddEnumMember(entry.first, name, delta.Version);
+    }
+  }
+
+
+  void VersionIndex::AddStruct(const std::string& name, const VersionRecord& version)
+  {
+    m_structs.emplace(name, version);
+  }
+
+
+  void VersionIndex::AddFunction(const std::string& name, const VersionRecord& version)
+  {
+    m_functions.emplace(name, version);
+  }
+
+
+  void VersionIndex::AddEnum(const std::string& name, const VersionRecord& version)
+  {
+    m_enums.emplace(name, version);
+  }
+
+
+  void VersionIndex::AddEnumMember(const std::string& enumName, const std::string& enumMemberName, const VersionRecord& version)
+  {
+    m_enumMembers[enumName].emplace(enumMemberName, version);
+  }
+
+
+  const VersionRecord& VersionIndex::GetStructVersion(const std::string& name) const
+  {
+    return Lookup(m_structs, name);
+  }
+
+
+  const VersionRecord& VersionIndex::GetFunctionVersion(const std::string& name) const
+  {
+    return Lookup(m_functions, name);
+  }
+
+
+  const VersionRecord& VersionIndex::GetEnumVersion(const std::string& name) const
+  {
+    return Lookup(m_enums, name);
+  }
+
+
+  const VersionRecord& VersionIndex::GetEnumMemberVersion(const std::string& enumName, const std::string& enumMemberName) const
+  {
+    const auto itrFind = m_enumMembers.find(enumName);
+    if (itrFind == m_enumMembers.end())
+      throw NotFoundException(std::string("'") + enumName + "' could not be found in history");
+    return Lookup(itrFind->second, enumMemberName);
+  }
+}